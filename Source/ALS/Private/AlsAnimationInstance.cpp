@@ -1,6 +1,7 @@
 #include "AlsAnimationInstance.h"
 
 #include "AlsCharacter.h"
+#include "AlsMotionMatchingSubsystem.h"
 #include "Animation/AnimInstanceProxy.h"
 #include "Components/CapsuleComponent.h"
 #include "Curves/CurveFloat.h"
@@ -22,6 +23,10 @@ void UAlsAnimationInstance::NativeInitializeAnimation()
 
 	Character = Cast<AAlsCharacter>(GetOwningActor());
 
+	// May be missing in editor preview worlds, in which case motion matching searches are not limited.
+
+	MotionMatchingSubsystem = GetWorld()->GetSubsystem<UAlsMotionMatchingSubsystem>();
+
 #if WITH_EDITOR
 	if (!GetWorld()->IsGameWorld() && !IsValid(Character))
 	{
@@ -102,6 +107,18 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 		ResetGroundedEntryMode();
 	}
 
+	RefreshLodOnGameThread(DeltaTime);
+	RefreshFarLodOnGameThread(DeltaTime);
+
+	// The pose is completely replaced by the far LOD cycle, so there is no need to refresh anything else.
+
+	if (FAnimWeight::IsFullWeight(FarLodState.Amount))
+	{
+		return;
+	}
+
+	RefreshLayeringOnGameThread();
+
 	RefreshViewOnGameThread();
 
 	RefreshLocomotionOnGameThread();
@@ -120,7 +137,7 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 
 	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
 
-	if (!IsValid(Settings) || !IsValid(Character))
+	if (!IsValid(Settings) || !IsValid(Character) || FAnimWeight::IsFullWeight(FarLodState.Amount))
 	{
 		return;
 	}
@@ -133,11 +150,15 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 	RefreshGrounded(DeltaTime);
 	RefreshInAir(DeltaTime);
 
+	RefreshMotionMatching(DeltaTime);
+
 	RefreshFeet(DeltaTime);
 
 	RefreshTransitions();
 	RefreshRotateInPlace(DeltaTime);
 	RefreshTurnInPlace(DeltaTime);
+
+	RefreshLinkedState();
 }
 
 void UAlsAnimationInstance::NativePostEvaluateAnimation()
@@ -171,40 +192,258 @@ void UAlsAnimationInstance::NativePostEvaluateAnimation()
 	bTeleported = false;
 }
 
+void UAlsAnimationInstance::RefreshLodOnGameThread(const float DeltaTime)
+{
+	check(IsInGameThread())
+
+	const auto& LodSettings{Settings->Lod};
+	const auto PredictedLod{GetSkelMeshComponent()->GetPredictedLODLevel()};
+
+	const auto bLodChanged{LodState.PredictedLod != PredictedLod};
+
+	if (bLodChanged || LodState.bRequiredBonesCheckPending)
+	{
+		const auto IsLodAllowed{
+			[PredictedLod](const int32 LodThreshold)
+			{
+				return LodThreshold <= 0 || PredictedLod < LodThreshold;
+			}
+		};
+
+		auto bFeetAllowed{IsLodAllowed(LodSettings.FeetLodThreshold)};
+		auto bFootOffsetTracesAllowed{bFeetAllowed && IsLodAllowed(LodSettings.FootOffsetTracesLodThreshold)};
+		auto bLeanAllowed{IsLodAllowed(LodSettings.LeanLodThreshold)};
+		auto bHandIkAllowed{IsLodAllowed(LodSettings.HandIkLodThreshold)};
+
+		if (bLodChanged)
+		{
+			LodState.PredictedLod = PredictedLod;
+
+			// The skeletal mesh recalculates its required bones for the new LOD only after the animation
+			// update, so they are checked on the next update, when they match the new LOD. Required
+			// bones change only with the LOD, so there is no need to check them every frame.
+
+			LodState.bRequiredBonesCheckPending = LodSettings.bDisableFeaturesForRemovedBones;
+
+			if (LodState.bRequiredBonesCheckPending)
+			{
+				// Until then, keep the features disabled by the previous check, so that
+				// they don't use bones that may still be removed for the current update.
+
+				bFeetAllowed &= LodState.bFeetAllowed;
+				bFootOffsetTracesAllowed &= LodState.bFootOffsetTracesAllowed;
+				bLeanAllowed &= LodState.bLeanAllowed;
+				bHandIkAllowed &= LodState.bHandIkAllowed;
+			}
+		}
+		else
+		{
+			LodState.bRequiredBonesCheckPending = false;
+
+			bFeetAllowed &= Settings->General.bUseFootIkBones
+				                ? IsBoneRequired(UAlsConstants::FootLeftIkBoneName()) &&
+				                  IsBoneRequired(UAlsConstants::FootRightIkBoneName())
+				                : IsBoneRequired(UAlsConstants::FootLeftVirtualBoneName()) &&
+				                  IsBoneRequired(UAlsConstants::FootRightVirtualBoneName());
+
+			bFootOffsetTracesAllowed &= bFeetAllowed;
+
+			bLeanAllowed &= IsBoneRequired(UAlsConstants::PelvisBoneName());
+
+			bHandIkAllowed &= IsBoneRequired(UAlsConstants::HandLeftGunVirtualBoneName()) &&
+				IsBoneRequired(UAlsConstants::HandRightGunVirtualBoneName());
+		}
+
+		LodState.bFeetAllowed = bFeetAllowed;
+		LodState.bFootOffsetTracesAllowed = bFootOffsetTracesAllowed;
+		LodState.bLeanAllowed = bLeanAllowed;
+		LodState.bHandIkAllowed = bHandIkAllowed;
+	}
+
+	if (bPendingUpdate)
+	{
+		LodState.FeetAmount = LodState.bFeetAllowed ? 1.0f : 0.0f;
+		LodState.HandIkAmount = LodState.bHandIkAllowed ? 1.0f : 0.0f;
+	}
+	else
+	{
+		LodState.FeetAmount = FMath::FInterpConstantTo(LodState.FeetAmount, LodState.bFeetAllowed ? 1.0f : 0.0f,
+		                                               DeltaTime, LodSettings.BlendSpeed);
+
+		LodState.HandIkAmount = FMath::FInterpConstantTo(LodState.HandIkAmount, LodState.bHandIkAllowed ? 1.0f : 0.0f,
+		                                                 DeltaTime, LodSettings.BlendSpeed);
+	}
+}
+
+bool UAlsAnimationInstance::IsBoneRequired(const FName& BoneName) const
+{
+	const auto* Mesh{GetSkelMeshComponent()};
+
+	const auto BoneIndex{Mesh->GetBoneIndex(BoneName)};
+
+	return BoneIndex != INDEX_NONE && Mesh->RequiredBones.Contains(static_cast<FBoneIndexType>(BoneIndex));
+}
+
+void UAlsAnimationInstance::RefreshFarLodOnGameThread(const float DeltaTime)
+{
+	check(IsInGameThread())
+
+	const auto& FarLodSettings{Settings->FarLod};
+
+	// Montages and locomotion actions require the full animation graph.
+
+	auto bFarLodAllowed{
+		FarLodSettings.LodThreshold > 0 && LocomotionMode == AlsLocomotionModeTags::Grounded &&
+		!LocomotionAction.IsValid() && !IsAnyMontagePlaying()
+	};
+
+	// Use a lower threshold to leave the far LOD than to enter it, so that the predicted
+	// LOD fluctuating around a single threshold doesn't switch it back and forth.
+
+	const auto ExitLodThreshold{
+		FarLodSettings.ExitLodThreshold > 0
+			? FMath::Min(FarLodSettings.ExitLodThreshold, FarLodSettings.LodThreshold)
+			: FarLodSettings.LodThreshold
+	};
+
+	const auto bFarLod{LodState.PredictedLod >= (FarLodState.bActive ? ExitLodThreshold : FarLodSettings.LodThreshold)};
+	const auto Speed{Character->GetLocomotionState().Speed};
+	const FAlsFarLodCycle* BestCycle{nullptr};
+
+	if (bFarLodAllowed && (bFarLod || FAnimWeight::IsRelevant(FarLodState.Amount)))
+	{
+		for (const auto& Cycle : FarLodSettings.Cycles)
+		{
+			if (IsValid(Cycle.Sequence) &&
+			    (!Cycle.Stance.IsValid() || Cycle.Stance == Stance) &&
+			    (!Cycle.Gait.IsValid() || Cycle.Gait == Gait) &&
+			    (!Cycle.OverlayMode.IsValid() || Cycle.OverlayMode == OverlayMode) &&
+			    (BestCycle == nullptr ||
+			     FMath::Abs(Cycle.ReferenceSpeed - Speed) < FMath::Abs(BestCycle->ReferenceSpeed - Speed)))
+			{
+				BestCycle = &Cycle;
+			}
+		}
+
+		// Without a matching cycle, the far LOD node falls back to the full animation graph,
+		// which must then be driven by an up-to-date state, so the far LOD can't stay active.
+
+		bFarLodAllowed = BestCycle != nullptr;
+	}
+
+	const auto bTargetActive{bFarLodAllowed && bFarLod};
+
+	if (FarLodState.bActive == bTargetActive)
+	{
+		FarLodState.SwitchTime = 0.0f;
+	}
+	else
+	{
+		FarLodState.SwitchTime += DeltaTime;
+
+		if (!bFarLodAllowed || FarLodState.SwitchTime >= FarLodSettings.SwitchDelay)
+		{
+			FarLodState.bActive = bTargetActive;
+			FarLodState.SwitchTime = 0.0f;
+		}
+	}
+
+	const auto bPreviouslyFullyActive{FAnimWeight::IsFullWeight(FarLodState.Amount)};
+
+	if (bPendingUpdate || !bFarLodAllowed || FarLodSettings.BlendDuration <= 0.0f)
+	{
+		FarLodState.Amount = FarLodState.bActive ? 1.0f : 0.0f;
+	}
+	else
+	{
+		FarLodState.Amount = FMath::FInterpConstantTo(FarLodState.Amount, FarLodState.bActive ? 1.0f : 0.0f,
+		                                              DeltaTime, 1.0f / FarLodSettings.BlendDuration);
+	}
+
+	// The state of the animation instance was not refreshed while the far LOD cycle was fully
+	// active, so treat the first refresh after that the same as after a long pause in updates.
+
+	if (bPreviouslyFullyActive && !FAnimWeight::IsFullWeight(FarLodState.Amount))
+	{
+		MarkPendingUpdate();
+	}
+
+	if (!FAnimWeight::IsRelevant(FarLodState.Amount) || BestCycle == nullptr)
+	{
+		FarLodState.Sequence = nullptr;
+		FarLodState.PlayRate = 1.0f;
+		return;
+	}
+
+	FarLodState.Sequence = BestCycle->Sequence;
+	FarLodState.PlayRate = BestCycle->ReferenceSpeed > 0.0f
+		                       ? FMath::Clamp(Speed / BestCycle->ReferenceSpeed,
+		                                      FarLodSettings.PlayRateRange.X, FarLodSettings.PlayRateRange.Y)
+		                       : 1.0f;
+}
+
+void UAlsAnimationInstance::RefreshLayeringOnGameThread()
+{
+	check(IsInGameThread())
+
+	if (!Settings->General.bUseLayeringAttributes)
+	{
+		return;
+	}
+
+	auto* Mesh{GetSkelMeshComponent()};
+	const auto& LayeringCurveNames{UAlsConstants::LayeringCurveNames()};
+
+	for (auto i{0}; i < static_cast<uint8>(EAlsLayeringCurve::Count); i++)
+	{
+		LayeringAttributes[i] = 0.0f;
+
+		Mesh->GetFloatAttribute_Ref(UAlsConstants::RootBoneName(), LayeringCurveNames[i],
+		                            LayeringAttributes[i], ECustomBoneAttributeLookup::BoneOnly);
+	}
+}
+
 void UAlsAnimationInstance::RefreshLayering()
 {
-	LayeringState.HeadBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHeadCurveName());
-	LayeringState.HeadAdditiveBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHeadAdditiveCurveName());
-	LayeringState.HeadSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHeadSlotCurveName());
+	LayeringState.HeadBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::Head);
+	LayeringState.HeadAdditiveBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::HeadAdditive);
+	LayeringState.HeadSlotBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::HeadSlot);
 
 	// The mesh space blend will always be 1 unless the local space blend is 1.
 
-	LayeringState.ArmLeftBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmLeftCurveName());
-	LayeringState.ArmLeftAdditiveBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmLeftAdditiveCurveName());
-	LayeringState.ArmLeftSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmLeftSlotCurveName());
-	LayeringState.ArmLeftLocalSpaceBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmLeftLocalSpaceCurveName());
+	LayeringState.ArmLeftBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::ArmLeft);
+	LayeringState.ArmLeftAdditiveBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::ArmLeftAdditive);
+	LayeringState.ArmLeftSlotBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::ArmLeftSlot);
+	LayeringState.ArmLeftLocalSpaceBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::ArmLeftLocalSpace);
 	LayeringState.ArmLeftMeshSpaceBlendAmount = !FAnimWeight::IsFullWeight(LayeringState.ArmLeftLocalSpaceBlendAmount);
 
 	// The mesh space blend will always be 1 unless the local space blend is 1.
 
-	LayeringState.ArmRightBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmRightCurveName());
-	LayeringState.ArmRightAdditiveBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmRightAdditiveCurveName());
-	LayeringState.ArmRightSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmRightSlotCurveName());
-	LayeringState.ArmRightLocalSpaceBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmRightLocalSpaceCurveName());
+	LayeringState.ArmRightBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::ArmRight);
+	LayeringState.ArmRightAdditiveBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::ArmRightAdditive);
+	LayeringState.ArmRightSlotBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::ArmRightSlot);
+	LayeringState.ArmRightLocalSpaceBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::ArmRightLocalSpace);
 	LayeringState.ArmRightMeshSpaceBlendAmount = !FAnimWeight::IsFullWeight(LayeringState.ArmRightLocalSpaceBlendAmount);
 
-	LayeringState.HandLeftBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHandLeftCurveName());
-	LayeringState.HandRightBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHandRightCurveName());
+	LayeringState.HandLeftBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::HandLeft);
+	LayeringState.HandRightBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::HandRight);
 
-	LayeringState.SpineBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerSpineCurveName());
-	LayeringState.SpineAdditiveBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerSpineAdditiveCurveName());
-	LayeringState.SpineSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerSpineSlotCurveName());
+	LayeringState.SpineBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::Spine);
+	LayeringState.SpineAdditiveBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::SpineAdditive);
+	LayeringState.SpineSlotBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::SpineSlot);
 
-	LayeringState.PelvisBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerPelvisCurveName());
-	LayeringState.PelvisSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerPelvisSlotCurveName());
+	LayeringState.PelvisBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::Pelvis);
+	LayeringState.PelvisSlotBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::PelvisSlot);
 
-	LayeringState.LegsBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerLegsCurveName());
-	LayeringState.LegsSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerLegsSlotCurveName());
+	LayeringState.LegsBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::Legs);
+	LayeringState.LegsSlotBlendAmount = GetLayeringAmountClamped01(EAlsLayeringCurve::LegsSlot);
+}
+
+float UAlsAnimationInstance::GetLayeringAmountClamped01(const EAlsLayeringCurve Curve) const
+{
+	return Settings->General.bUseLayeringAttributes
+		       ? UAlsMath::Clamp01(LayeringAttributes[static_cast<uint8>(Curve)])
+		       : GetCurveValueClamped01(UAlsConstants::LayeringCurveNames()[static_cast<uint8>(Curve)]);
 }
 
 void UAlsAnimationInstance::RefreshPose()
@@ -234,6 +473,25 @@ void UAlsAnimationInstance::RefreshPose()
 	PoseState.UnweightedGaitSprintingAmount = UAlsMath::Clamp01(PoseState.UnweightedGaitAmount - 2.0f);
 }
 
+void UAlsAnimationInstance::RefreshLinkedState()
+{
+	// Linked animation instances are updated after this instance, so by copying the state here they
+	// always read a consistent snapshot, and never values that are being written in the same update.
+
+	LinkedState.ViewMode = ViewMode;
+	LinkedState.LocomotionMode = LocomotionMode;
+	LinkedState.RotationMode = RotationMode;
+	LinkedState.Stance = Stance;
+	LinkedState.Gait = Gait;
+	LinkedState.OverlayMode = OverlayMode;
+	LinkedState.LocomotionAction = LocomotionAction;
+
+	LinkedState.Layering = LayeringState;
+	LinkedState.View = ViewState;
+	LinkedState.Locomotion = LocomotionState;
+	LinkedState.Feet = FeetState;
+}
+
 void UAlsAnimationInstance::RefreshViewOnGameThread()
 {
 	check(IsInGameThread())
@@ -536,6 +794,14 @@ void UAlsAnimationInstance::RefreshGrounded(const float DeltaTime)
 			LocomotionState.MaxBrakingDeceleration);
 	}
 
+	if (Settings->MotionMatching.bEnabled)
+	{
+		// The locomotion cycle is driven by motion matching, so only the lean is still needed.
+
+		RefreshGroundedLeanAmount(RelativeAccelerationAmount, DeltaTime);
+		return;
+	}
+
 	RefreshMovementDirection();
 	RefreshVelocityBlend(DeltaTime);
 	RefreshRotationYawOffsets();
@@ -597,21 +863,23 @@ void UAlsAnimationInstance::RefreshVelocityBlend(const float DeltaTime)
 	}
 	else
 	{
-		GroundedState.VelocityBlend.ForwardAmount = FMath::FInterpTo(GroundedState.VelocityBlend.ForwardAmount,
-		                                                             UAlsMath::Clamp01(RelativeDirection.X), DeltaTime,
-		                                                             Settings->Grounded.VelocityBlendInterpolationSpeed);
+		const auto InterpolationSpeed{Settings->Grounded.VelocityBlendInterpolationSpeed};
+
+		GroundedState.VelocityBlend.ForwardAmount = UAlsMath::ExponentialDecay(GroundedState.VelocityBlend.ForwardAmount,
+		                                                                       UAlsMath::Clamp01(RelativeDirection.X),
+		                                                                       DeltaTime, InterpolationSpeed);
 
-		GroundedState.VelocityBlend.BackwardAmount = FMath::FInterpTo(GroundedState.VelocityBlend.BackwardAmount,
-		                                                              FMath::Abs(FMath::Clamp(RelativeDirection.X, -1.0f, 0.0f)), DeltaTime,
-		                                                              Settings->Grounded.VelocityBlendInterpolationSpeed);
+		GroundedState.VelocityBlend.BackwardAmount = UAlsMath::ExponentialDecay(GroundedState.VelocityBlend.BackwardAmount,
+		                                                                        FMath::Abs(FMath::Clamp(RelativeDirection.X, -1.0f, 0.0f)),
+		                                                                        DeltaTime, InterpolationSpeed);
 
-		GroundedState.VelocityBlend.LeftAmount = FMath::FInterpTo(GroundedState.VelocityBlend.LeftAmount,
-		                                                          FMath::Abs(FMath::Clamp(RelativeDirection.Y, -1.0f, 0.0f)), DeltaTime,
-		                                                          Settings->Grounded.VelocityBlendInterpolationSpeed);
+		GroundedState.VelocityBlend.LeftAmount = UAlsMath::ExponentialDecay(GroundedState.VelocityBlend.LeftAmount,
+		                                                                    FMath::Abs(FMath::Clamp(RelativeDirection.Y, -1.0f, 0.0f)),
+		                                                                    DeltaTime, InterpolationSpeed);
 
-		GroundedState.VelocityBlend.RightAmount = FMath::FInterpTo(GroundedState.VelocityBlend.RightAmount,
-		                                                           UAlsMath::Clamp01(RelativeDirection.Y), DeltaTime,
-		                                                           Settings->Grounded.VelocityBlendInterpolationSpeed);
+		GroundedState.VelocityBlend.RightAmount = UAlsMath::ExponentialDecay(GroundedState.VelocityBlend.RightAmount,
+		                                                                     UAlsMath::Clamp01(RelativeDirection.Y),
+		                                                                     DeltaTime, InterpolationSpeed);
 	}
 }
 
@@ -717,6 +985,12 @@ void UAlsAnimationInstance::RefreshCrouchingPlayRate()
 
 void UAlsAnimationInstance::RefreshGroundedLeanAmount(const FVector3f& RelativeAccelerationAmount, const float DeltaTime)
 {
+	if (!LodState.bLeanAllowed)
+	{
+		ResetGroundedLeanAmount(DeltaTime);
+		return;
+	}
+
 	if (bPendingUpdate)
 	{
 		LeanState.RightAmount = RelativeAccelerationAmount.Y;
@@ -724,11 +998,11 @@ void UAlsAnimationInstance::RefreshGroundedLeanAmount(const FVector3f& RelativeA
 	}
 	else
 	{
-		LeanState.RightAmount = FMath::FInterpTo(LeanState.RightAmount, RelativeAccelerationAmount.Y,
-		                                         DeltaTime, Settings->General.LeanInterpolationSpeed);
+		LeanState.RightAmount = UAlsMath::ExponentialDecay(LeanState.RightAmount, RelativeAccelerationAmount.Y,
+		                                                   DeltaTime, Settings->General.LeanInterpolationSpeed);
 
-		LeanState.ForwardAmount = FMath::FInterpTo(LeanState.ForwardAmount, RelativeAccelerationAmount.X,
-		                                           DeltaTime, Settings->General.LeanInterpolationSpeed);
+		LeanState.ForwardAmount = UAlsMath::ExponentialDecay(LeanState.ForwardAmount, RelativeAccelerationAmount.X,
+		                                                     DeltaTime, Settings->General.LeanInterpolationSpeed);
 	}
 }
 
@@ -741,8 +1015,11 @@ void UAlsAnimationInstance::ResetGroundedLeanAmount(const float DeltaTime)
 	}
 	else
 	{
-		LeanState.RightAmount = FMath::FInterpTo(LeanState.RightAmount, 0.0f, DeltaTime, Settings->General.LeanInterpolationSpeed);
-		LeanState.ForwardAmount = FMath::FInterpTo(LeanState.ForwardAmount, 0.0f, DeltaTime, Settings->General.LeanInterpolationSpeed);
+		LeanState.RightAmount = UAlsMath::ExponentialDecay(LeanState.RightAmount, 0.0f,
+		                                                   DeltaTime, Settings->General.LeanInterpolationSpeed);
+
+		LeanState.ForwardAmount = UAlsMath::ExponentialDecay(LeanState.ForwardAmount, 0.0f,
+		                                                     DeltaTime, Settings->General.LeanInterpolationSpeed);
 	}
 }
 
@@ -860,6 +1137,12 @@ void UAlsAnimationInstance::RefreshGroundPredictionAmount()
 
 void UAlsAnimationInstance::RefreshInAirLeanAmount(const float DeltaTime)
 {
+	if (!LodState.bLeanAllowed)
+	{
+		ResetGroundedLeanAmount(DeltaTime);
+		return;
+	}
+
 	// Use the relative velocity direction and amount to determine how much the character should lean
 	// while in air. The lean amount curve gets the vertical velocity and is used as a multiplier to
 	// smoothly reverse the leaning direction when transitioning from moving upwards to moving downwards.
@@ -878,11 +1161,101 @@ void UAlsAnimationInstance::RefreshInAirLeanAmount(const float DeltaTime)
 	}
 	else
 	{
-		LeanState.RightAmount = FMath::FInterpTo(LeanState.RightAmount, RelativeVelocity.Y,
-		                                         DeltaTime, Settings->General.LeanInterpolationSpeed);
+		LeanState.RightAmount = UAlsMath::ExponentialDecay(LeanState.RightAmount, RelativeVelocity.Y,
+		                                                   DeltaTime, Settings->General.LeanInterpolationSpeed);
+
+		LeanState.ForwardAmount = UAlsMath::ExponentialDecay(LeanState.ForwardAmount, RelativeVelocity.X,
+		                                                     DeltaTime, Settings->General.LeanInterpolationSpeed);
+	}
+}
+
+void UAlsAnimationInstance::RefreshMotionMatching(const float DeltaTime)
+{
+	if (!Settings->MotionMatching.bEnabled)
+	{
+		return;
+	}
+
+	// Search only the database that matches the current state, and no more often than the search interval allows.
+
+	const auto NewDatabaseIndex{FindMotionMatchingDatabaseIndex()};
+
+	MotionMatchingState.SearchTimeRemaining -= DeltaTime;
+
+	// Searches requested by the search interval are also limited by the budget shared by all animation instances in
+	// the world. A search over the budget is postponed to one of the next frames, since the search time has elapsed.
+
+	if (MotionMatchingState.DatabaseIndex != NewDatabaseIndex ||
+	    (MotionMatchingState.SearchTimeRemaining <= 0.0f &&
+	     (!IsValid(MotionMatchingSubsystem) ||
+	      MotionMatchingSubsystem->TryStartSearch(Settings->MotionMatching.MaxSearchesPerFrame))))
+	{
+		MotionMatchingState.DatabaseIndex = NewDatabaseIndex;
+		MotionMatchingState.Database = NewDatabaseIndex != INDEX_NONE
+			                               ? Settings->MotionMatching.Databases[NewDatabaseIndex].Database
+			                               : nullptr;
+
+		MotionMatchingState.bSearchRequested = IsValid(MotionMatchingState.Database);
+		MotionMatchingState.SearchTimeRemaining = Settings->MotionMatching.SearchInterval;
+	}
+	else
+	{
+		MotionMatchingState.bSearchRequested = false;
+	}
+
+	RefreshMotionMatchingTrajectory();
+}
+
+int32 UAlsAnimationInstance::FindMotionMatchingDatabaseIndex() const
+{
+	const auto& Databases{Settings->MotionMatching.Databases};
+
+	for (auto i{0}; i < Databases.Num(); i++)
+	{
+		const auto& Database{Databases[i]};
+
+		if ((!Database.Stance.IsValid() || Database.Stance == Stance) &&
+		    (!Database.Gait.IsValid() || Database.Gait == Gait) &&
+		    (!Database.RotationMode.IsValid() || Database.RotationMode == RotationMode) &&
+		    (!Database.OverlayMode.IsValid() || Database.OverlayMode == OverlayMode))
+		{
+			return i;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void UAlsAnimationInstance::RefreshMotionMatchingTrajectory()
+{
+	const auto& SampleTimes{Settings->MotionMatching.TrajectorySampleTimes};
+
+	MotionMatchingState.TrajectoryLocations.SetNum(SampleTimes.Num(), false);
+	MotionMatchingState.TrajectoryVelocities.SetNum(SampleTimes.Num(), false);
+
+	// Predict the trajectory assuming constant acceleration, but stop the character
+	// instead of moving it backwards when the acceleration opposes the velocity.
+
+	FVector Location{ForceInit};
+	auto Velocity{LocomotionState.Velocity};
+	auto PreviousSampleTime{0.0f};
+
+	for (auto i{0}; i < SampleTimes.Num(); i++)
+	{
+		const auto DeltaTime{FMath::Max(0.0f, SampleTimes[i] - PreviousSampleTime)};
+		PreviousSampleTime = SampleTimes[i];
+
+		auto NewVelocity{Velocity + LocomotionState.Acceleration * DeltaTime};
+		if ((NewVelocity | Velocity) < 0.0f)
+		{
+			NewVelocity = FVector::ZeroVector;
+		}
 
-		LeanState.ForwardAmount = FMath::FInterpTo(LeanState.ForwardAmount, RelativeVelocity.X,
-		                                           DeltaTime, Settings->General.LeanInterpolationSpeed);
+		Location += (Velocity + NewVelocity) * (0.5f * DeltaTime);
+		Velocity = NewVelocity;
+
+		MotionMatchingState.TrajectoryLocations[i] = LocomotionState.RotationQuaternion.UnrotateVector(Location);
+		MotionMatchingState.TrajectoryVelocities[i] = LocomotionState.RotationQuaternion.UnrotateVector(Velocity);
 	}
 }
 
@@ -890,6 +1263,11 @@ void UAlsAnimationInstance::RefreshFeetOnGameThread()
 {
 	check(IsInGameThread())
 
+	if (!FAnimWeight::IsRelevant(LodState.FeetAmount))
+	{
+		return;
+	}
+
 	const auto* Mesh{GetSkelMeshComponent()};
 
 	const auto FootLeftTargetTransform{
@@ -918,6 +1296,16 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 
 	FeetState.MinMaxPelvisOffsetZ = FVector2D::ZeroVector;
 
+	if (!FAnimWeight::IsRelevant(LodState.FeetAmount))
+	{
+		// Feet are disabled at the current LOD, so skip foot locking and offsets
+		// entirely and make sure they start from scratch when feet are enabled again.
+
+		FeetState.Left = {};
+		FeetState.Right = {};
+		return;
+	}
+
 	const auto ComponentTransformInverse{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().Inverse()};
 
 	RefreshFoot(FeetState.Left, UAlsConstants::FootLeftIkCurveName(),
@@ -936,7 +1324,7 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& FootIkCurveName, const FName& FootLockCurveName,
                                         const FTransform& ComponentTransformInverse, const float DeltaTime) const
 {
-	FootState.IkAmount = GetCurveValueClamped01(FootIkCurveName);
+	FootState.IkAmount = GetCurveValueClamped01(FootIkCurveName) * LodState.FeetAmount;
 
 	ProcessFootLockTeleport(FootState);
 
@@ -1139,8 +1527,11 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		{
 			static constexpr auto InterpolationSpeed{15.0f};
 
-			FootState.OffsetLocation = FMath::VInterpTo(FootState.OffsetLocation, FVector::ZeroVector, DeltaTime, InterpolationSpeed);
-			FootState.OffsetRotation = FMath::QInterpTo(FootState.OffsetRotation, FQuat::Identity, DeltaTime, InterpolationSpeed);
+			FootState.OffsetLocation = UAlsMath::ExponentialDecay(FootState.OffsetLocation, FVector::ZeroVector,
+			                                                      DeltaTime, InterpolationSpeed);
+
+			FootState.OffsetRotation = UAlsMath::ExponentialDecay(FootState.OffsetRotation, FQuat::Identity,
+			                                                      DeltaTime, InterpolationSpeed);
 
 			FinalLocation += FootState.OffsetLocation;
 			FinalRotation = FootState.OffsetRotation * FinalRotation;
@@ -1149,6 +1540,49 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		return;
 	}
 
+	if (!LodState.bFootOffsetTracesAllowed)
+	{
+		// Smoothly remove the foot offset without tracing.
+
+		FootState.OffsetTargetLocation = FVector::ZeroVector;
+		FootState.OffsetTargetRotation = FQuat::Identity;
+	}
+	else
+	{
+		RefreshFootOffsetTarget(FootState, FinalLocation);
+	}
+
+	// Interpolate current offsets to the new target values.
+
+	if (bPendingUpdate)
+	{
+		FootState.OffsetSpringState.Reset();
+
+		FootState.OffsetLocation = FootState.OffsetTargetLocation;
+		FootState.OffsetRotation = FootState.OffsetTargetRotation;
+	}
+	else
+	{
+		static constexpr auto LocationInterpolationFrequency{0.4f};
+		static constexpr auto LocationInterpolationDampingRatio{4.0f};
+		static constexpr auto LocationInterpolationTargetVelocityAmount{1.0f};
+
+		FootState.OffsetLocation = UAlsMath::SpringDamp(FootState.OffsetLocation, FootState.OffsetTargetLocation,
+		                                                FootState.OffsetSpringState, DeltaTime, LocationInterpolationFrequency,
+		                                                LocationInterpolationDampingRatio, LocationInterpolationTargetVelocityAmount);
+
+		static constexpr auto RotationInterpolationSpeed{30.0f};
+
+		FootState.OffsetRotation = UAlsMath::ExponentialDecay(FootState.OffsetRotation, FootState.OffsetTargetRotation,
+		                                                      DeltaTime, RotationInterpolationSpeed);
+	}
+
+	FinalLocation += FootState.OffsetLocation;
+	FinalRotation = FootState.OffsetRotation * FinalRotation;
+}
+
+void UAlsAnimationInstance::RefreshFootOffsetTarget(FAlsFootState& FootState, const FVector& FinalLocation) const
+{
 	// Trace downward from the foot location to find the geometry. If the surface is walkable, save the impact location and normal.
 
 	const FVector TraceLocation{
@@ -1206,34 +1640,6 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 			UAlsMath::DirectionToAngle({Hit.ImpactNormal.Z, Hit.ImpactNormal.Y})
 		}.Quaternion();
 	}
-
-	// Interpolate current offsets to the new target values.
-
-	if (bPendingUpdate)
-	{
-		FootState.OffsetSpringState.Reset();
-
-		FootState.OffsetLocation = FootState.OffsetTargetLocation;
-		FootState.OffsetRotation = FootState.OffsetTargetRotation;
-	}
-	else
-	{
-		static constexpr auto LocationInterpolationFrequency{0.4f};
-		static constexpr auto LocationInterpolationDampingRatio{4.0f};
-		static constexpr auto LocationInterpolationTargetVelocityAmount{1.0f};
-
-		FootState.OffsetLocation = UAlsMath::SpringDamp(FootState.OffsetLocation, FootState.OffsetTargetLocation,
-		                                                FootState.OffsetSpringState, DeltaTime, LocationInterpolationFrequency,
-		                                                LocationInterpolationDampingRatio, LocationInterpolationTargetVelocityAmount);
-
-		static constexpr auto RotationInterpolationSpeed{30.0f};
-
-		FootState.OffsetRotation = FMath::QInterpTo(FootState.OffsetRotation, FootState.OffsetTargetRotation,
-		                                            DeltaTime, RotationInterpolationSpeed);
-	}
-
-	FinalLocation += FootState.OffsetLocation;
-	FinalRotation = FootState.OffsetRotation * FinalRotation;
 }
 
 void UAlsAnimationInstance::PlayQuickStopAnimation()
@@ -1299,9 +1705,7 @@ void UAlsAnimationInstance::PlayTransitionLeftAnimation(const float BlendInDurat
 		return;
 	}
 
-	PlayTransitionAnimation(Stance == AlsStanceTags::Crouching
-		                        ? Settings->Transitions.CrouchingTransitionLeftAnimation
-		                        : Settings->Transitions.StandingTransitionLeftAnimation,
+	PlayTransitionAnimation(Settings->Transitions.GetTransitionAnimation(Stance, true),
 	                        BlendInDuration, BlendOutDuration, PlayRate, StartTime, bFromStandingIdleOnly);
 }
 
@@ -1313,9 +1717,7 @@ void UAlsAnimationInstance::PlayTransitionRightAnimation(const float BlendInDura
 		return;
 	}
 
-	PlayTransitionAnimation(Stance == AlsStanceTags::Crouching
-		                        ? Settings->Transitions.CrouchingTransitionRightAnimation
-		                        : Settings->Transitions.StandingTransitionRightAnimation,
+	PlayTransitionAnimation(Settings->Transitions.GetTransitionAnimation(Stance, false),
 	                        BlendInDuration, BlendOutDuration, PlayRate, StartTime, bFromStandingIdleOnly);
 }
 
@@ -1374,34 +1776,13 @@ void UAlsAnimationInstance::RefreshDynamicTransition()
 		return;
 	}
 
-	TObjectPtr<UAnimSequenceBase> DynamicTransitionAnimation;
-
 	// If both transitions are allowed, choose the one with a greater lock distance.
 
-	if (!bTransitionLeftAllowed)
-	{
-		DynamicTransitionAnimation = Stance == AlsStanceTags::Crouching
-			                             ? Settings->Transitions.CrouchingDynamicTransitionRightAnimation
-			                             : Settings->Transitions.StandingDynamicTransitionRightAnimation;
-	}
-	else if (!bTransitionRightAllowed)
-	{
-		DynamicTransitionAnimation = Stance == AlsStanceTags::Crouching
-			                             ? Settings->Transitions.CrouchingDynamicTransitionLeftAnimation
-			                             : Settings->Transitions.StandingDynamicTransitionLeftAnimation;
-	}
-	else if (FootLockLeftDistanceSquared >= FootLockRightDistanceSquared)
-	{
-		DynamicTransitionAnimation = Stance == AlsStanceTags::Crouching
-			                             ? Settings->Transitions.CrouchingDynamicTransitionLeftAnimation
-			                             : Settings->Transitions.StandingDynamicTransitionLeftAnimation;
-	}
-	else
-	{
-		DynamicTransitionAnimation = Stance == AlsStanceTags::Crouching
-			                             ? Settings->Transitions.CrouchingDynamicTransitionRightAnimation
-			                             : Settings->Transitions.StandingDynamicTransitionRightAnimation;
-	}
+	const auto bTransitionLeft{
+		!bTransitionRightAllowed || (bTransitionLeftAllowed && FootLockLeftDistanceSquared >= FootLockRightDistanceSquared)
+	};
+
+	const auto DynamicTransitionAnimation{Settings->Transitions.GetDynamicTransitionAnimation(Stance, bTransitionLeft)};
 
 	if (IsValid(DynamicTransitionAnimation))
 	{
@@ -1450,9 +1831,9 @@ void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 
 		RotateInPlaceState.PlayRate = bPendingUpdate
 			                              ? UE_REAL_TO_FLOAT(Settings->RotateInPlace.PlayRate.X)
-			                              : FMath::FInterpTo(RotateInPlaceState.PlayRate,
-			                                                 UE_REAL_TO_FLOAT(Settings->RotateInPlace.PlayRate.X),
-			                                                 DeltaTime, PlayRateInterpolationSpeed);
+			                              : UAlsMath::ExponentialDecay(RotateInPlaceState.PlayRate,
+			                                                           UE_REAL_TO_FLOAT(Settings->RotateInPlace.PlayRate.X),
+			                                                           DeltaTime, PlayRateInterpolationSpeed);
 
 		RotateInPlaceState.FootLockBlockAmount = 0.0f;
 		return;
@@ -1467,9 +1848,9 @@ void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 	{
 		RotateInPlaceState.PlayRate = bPendingUpdate
 			                              ? UE_REAL_TO_FLOAT(Settings->RotateInPlace.PlayRate.X)
-			                              : FMath::FInterpTo(RotateInPlaceState.PlayRate,
-			                                                 UE_REAL_TO_FLOAT(Settings->RotateInPlace.PlayRate.X),
-			                                                 DeltaTime, PlayRateInterpolationSpeed);
+			                              : UAlsMath::ExponentialDecay(RotateInPlaceState.PlayRate,
+			                                                           UE_REAL_TO_FLOAT(Settings->RotateInPlace.PlayRate.X),
+			                                                           DeltaTime, PlayRateInterpolationSpeed);
 
 		RotateInPlaceState.FootLockBlockAmount = 0.0f;
 		return;
@@ -1485,8 +1866,8 @@ void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 
 	RotateInPlaceState.PlayRate = bPendingUpdate
 		                              ? PlayRate
-		                              : FMath::FInterpTo(RotateInPlaceState.PlayRate, PlayRate,
-		                                                 DeltaTime, PlayRateInterpolationSpeed);
+		                              : UAlsMath::ExponentialDecay(RotateInPlaceState.PlayRate, PlayRate,
+		                                                           DeltaTime, PlayRateInterpolationSpeed);
 
 	// Disable foot locking when rotating at a large angle or rotating too fast, otherwise the legs may twist in a spiral.
 
@@ -1501,7 +1882,7 @@ void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 			? 0.0f
 			: bPendingUpdate
 			? 1.0f
-			: FMath::FInterpTo(RotateInPlaceState.FootLockBlockAmount, 1.0f, DeltaTime, BlockInterpolationSpeed);
+			: UAlsMath::ExponentialDecay(RotateInPlaceState.FootLockBlockAmount, 1.0f, DeltaTime, BlockInterpolationSpeed);
 }
 
 bool UAlsAnimationInstance::IsTurnInPlaceAllowed()
@@ -4,7 +4,6 @@
 #include "AlsCharacterMovementComponent.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
-#include "Curves/CurveFloat.h"
 #include "GameFramework/GameNetworkManager.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
@@ -78,8 +77,12 @@ void AAlsCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, OverlayMode, Parameters)
 
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RawViewRotation, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ViewFocusTarget, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InputDirection, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RagdollTargetLocation, Parameters)
+
+	Parameters.Condition = COND_ReplayOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplayState, Parameters)
 }
 
 void AAlsCharacter::PreRegisterAllComponents()
@@ -121,8 +124,6 @@ void AAlsCharacter::PostInitializeComponents()
 
 	GetMesh()->AddTickPrerequisiteActor(this);
 
-	AlsCharacterMovement->OnPhysicsRotation.AddUObject(this, &ThisClass::CharacterMovement_OnPhysicsRotation);
-
 	// Pass current movement settings to the movement component.
 
 	AlsCharacterMovement->SetMovementSettings(MovementSettings);
@@ -241,14 +242,23 @@ void AAlsCharacter::Tick(const float DeltaTime)
 
 	RefreshGait();
 
-	RefreshGroundedRotation(DeltaTime);
-	RefreshInAirRotation(DeltaTime);
+	// Unless the rotation has already been refreshed by the character movement component after each of
+	// its fixed time steps, which also happens on the server when it replays the moves of the client.
+
+	if (!AlsCharacterMovement->IsFixedTimeStepRotationActive())
+	{
+		RefreshGroundedRotation(DeltaTime);
+		RefreshInAirRotation(DeltaTime);
+	}
 
 	TryStartMantlingInAir();
 
 	RefreshMantling();
 	RefreshRagdolling(DeltaTime);
-	RefreshRolling(DeltaTime);
+	RefreshRolling();
+	RefreshPendingClientRolling();
+
+	RefreshReplayState(DeltaTime);
 
 	if (LocomotionState.bRotationLocked)
 	{
@@ -304,6 +314,29 @@ void AAlsCharacter::RefreshVisibilityBasedAnimTickOption() const
 	GetMesh()->VisibilityBasedAnimTickOption = TargetTickOption <= DefaultTickOption ? TargetTickOption : DefaultTickOption;
 }
 
+void AAlsCharacter::RestoreRecordedState(const FGameplayTag& NewLocomotionMode, const FGameplayTag& NewRotationMode,
+                                         const FGameplayTag& NewStance, const FGameplayTag& NewGait)
+{
+	SetLocomotionMode(NewLocomotionMode);
+
+	// Change the capsule size immediately instead of waiting for the next character movement update.
+
+	if (NewStance == AlsStanceTags::Crouching)
+	{
+		Crouch();
+		AlsCharacterMovement->Crouch();
+	}
+	else
+	{
+		UnCrouch();
+		AlsCharacterMovement->UnCrouch();
+	}
+
+	SetStance(NewStance);
+	SetRotationMode(NewRotationMode);
+	SetGait(NewGait);
+}
+
 void AAlsCharacter::SetViewMode(const FGameplayTag& NewViewMode)
 {
 	if (ViewMode != NewViewMode)
@@ -372,6 +405,12 @@ void AAlsCharacter::NotifyLocomotionModeChanged(const FGameplayTag& PreviousLoco
 		{
 			StartRagdolling();
 		}
+		else if (IsValid(RollingState.PendingMontage))
+		{
+			// The owning client has already started rolling on landing, so use its request instead of starting a new rolling.
+
+			RefreshPendingClientRolling();
+		}
 		else if (Settings->Rolling.bStartRollingOnLand &&
 		         LocomotionState.Velocity.Z <= -Settings->Rolling.RollingOnLandSpeedThreshold)
 		{
@@ -413,6 +452,10 @@ void AAlsCharacter::NotifyLocomotionModeChanged(const FGameplayTag& PreviousLoco
 		StartRagdolling();
 	}
 
+	// Cancel the rolling requested by the owning client while the character was in the air if it didn't land.
+
+	RefreshPendingClientRolling();
+
 	OnLocomotionModeChanged(PreviousLocomotionMode);
 }
 
@@ -822,11 +865,20 @@ void AAlsCharacter::NotifyLocomotionActionChanged(const FGameplayTag& PreviousLo
 {
 	ApplyDesiredStance();
 
+	LocomotionActionChanged.Broadcast(PreviousLocomotionAction);
+
 	OnLocomotionActionChanged(PreviousLocomotionAction);
 }
 
 void AAlsCharacter::OnLocomotionActionChanged_Implementation(const FGameplayTag& PreviousLocomotionAction) {}
 
+bool AAlsCharacter::MatchesStateGate(const FAlsStateGate& Gate) const
+{
+	const FGameplayTag StateTags[]{ViewMode, LocomotionMode, RotationMode, Stance, Gait, OverlayMode, LocomotionAction};
+
+	return Gate.Matches(StateTags);
+}
+
 FRotator AAlsCharacter::GetViewRotation() const
 {
 	return ViewState.Rotation;
@@ -838,7 +890,12 @@ void AAlsCharacter::SetRawViewRotation(const FRotator& NewViewRotation)
 	{
 		RawViewRotation = NewViewRotation;
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RawViewRotation, this)
+		// Simulated proxies calculate the view rotation from the focus target, so there is no need to replicate it.
+
+		if (!ViewFocusTarget.bValid)
+		{
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RawViewRotation, this)
+		}
 
 		// The character movement component already sends the view rotation to the
 		// server if the movement is replicated, so we don't have to do it ourselves.
@@ -920,17 +977,48 @@ void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& NewViewRotation)
 	NetworkSmoothing.Duration = NetworkSmoothing.ServerTime - NetworkSmoothing.ClientTime;
 }
 
+void AAlsCharacter::SetViewFocusTarget(const FAlsViewFocusTarget& NewFocusTarget)
+{
+	if (GetLocalRole() < ROLE_Authority)
+	{
+		return;
+	}
+
+	if (ViewFocusTarget.bValid != NewFocusTarget.bValid ||
+	    ViewFocusTarget.Actor != NewFocusTarget.Actor ||
+	    ViewFocusTarget.Location != NewFocusTarget.Location)
+	{
+		ViewFocusTarget = NewFocusTarget;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ViewFocusTarget, this)
+
+		// Make sure simulated proxies receive the current view rotation once the focus target is no longer used.
+
+		if (!ViewFocusTarget.bValid)
+		{
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RawViewRotation, this)
+		}
+	}
+}
+
 void AAlsCharacter::RefreshView(const float DeltaTime)
 {
 	ViewState.PreviousYawAngle = UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw);
 
-	// ReSharper disable once CppRedundantParentheses
-	if ((IsReplicatingMovement() && GetLocalRole() >= ROLE_AutonomousProxy) || IsLocallyControlled())
+	if (ViewFocusTarget.bValid)
 	{
-		SetRawViewRotation(Super::GetViewRotation().GetNormalized());
+		RefreshViewFocus(DeltaTime);
 	}
+	else
+	{
+		// ReSharper disable once CppRedundantParentheses
+		if ((IsReplicatingMovement() && GetLocalRole() >= ROLE_AutonomousProxy) || IsLocallyControlled())
+		{
+			SetRawViewRotation(Super::GetViewRotation().GetNormalized());
+		}
 
-	RefreshViewNetworkSmoothing(DeltaTime);
+		RefreshViewNetworkSmoothing(DeltaTime);
+	}
 
 	ViewState.Rotation = ViewState.NetworkSmoothing.Rotation;
 
@@ -973,6 +1061,46 @@ void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
 	}
 }
 
+void AAlsCharacter::RefreshViewFocus(const float DeltaTime)
+{
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		SetRawViewRotation(Super::GetViewRotation().GetNormalized());
+	}
+	else
+	{
+		// Based on AAIController::UpdateControlRotation() and AAlsAIController::GetFocalPointOnActor().
+
+		const auto* FocusActor{ViewFocusTarget.Actor.Get()};
+		const auto* FocusPawn{Cast<APawn>(FocusActor)};
+
+		const auto FocalPoint{
+			IsValid(FocusPawn)
+				? FocusPawn->GetPawnViewLocation()
+				: IsValid(FocusActor)
+				? FocusActor->GetActorLocation()
+				: FVector{ViewFocusTarget.Location}
+		};
+
+		RawViewRotation = (FocalPoint - GetPawnViewLocation()).Rotation().GetNormalized();
+
+		// Don't pitch the view unless looking at another pawn.
+
+		if (!IsValid(FocusPawn))
+		{
+			RawViewRotation.Pitch = 0.0f;
+		}
+	}
+
+	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
+
+	NetworkSmoothing.Rotation = UAlsMath::ExponentialDecay(NetworkSmoothing.Rotation, RawViewRotation,
+	                                                       DeltaTime, Settings->View.FocusInterpolationSpeed);
+
+	NetworkSmoothing.InitialRotation = NetworkSmoothing.Rotation;
+	NetworkSmoothing.ClientTime = NetworkSmoothing.ServerTime;
+}
+
 void AAlsCharacter::SetInputDirection(FVector NewInputDirection)
 {
 	NewInputDirection = NewInputDirection.GetSafeNormal();
@@ -1026,6 +1154,14 @@ void AAlsCharacter::RefreshLocomotion(const float DeltaTime)
 	LocomotionState.PreviousVelocity = LocomotionState.Velocity;
 	LocomotionState.PreviousYawAngle = UE_REAL_TO_FLOAT(LocomotionState.Rotation.Yaw);
 
+	LocomotionState.Velocity = GetVelocity();
+	LocomotionState.Acceleration = (LocomotionState.Velocity - LocomotionState.PreviousVelocity) / DeltaTime;
+
+	RefreshLocomotionInputAndSpeed();
+}
+
+void AAlsCharacter::RefreshLocomotionInputAndSpeed()
+{
 	if (GetLocalRole() >= ROLE_AutonomousProxy)
 	{
 		SetInputDirection(GetCharacterMovement()->GetCurrentAcceleration() / GetCharacterMovement()->GetMaxAcceleration());
@@ -1040,23 +1176,21 @@ void AAlsCharacter::RefreshLocomotion(const float DeltaTime)
 		LocomotionState.InputYawAngle = UE_REAL_TO_FLOAT(UAlsMath::DirectionToAngleXY(InputDirection));
 	}
 
-	LocomotionState.Velocity = GetVelocity();
-
 	// Determine if the character is moving by getting its speed. The speed equals the length
 	// of the horizontal velocity, so it does not take vertical movement into account. If the
 	// character is moving, update the last velocity rotation. This value is saved because it might
 	// be useful to know the last orientation of a movement even after the character has stopped.
 
-	LocomotionState.Speed = UE_REAL_TO_FLOAT(LocomotionState.Velocity.Size2D());
+	const auto Velocity{GetVelocity()};
+
+	LocomotionState.Speed = UE_REAL_TO_FLOAT(Velocity.Size2D());
 	LocomotionState.bHasSpeed = LocomotionState.Speed >= 1.0f;
 
 	if (LocomotionState.bHasSpeed)
 	{
-		LocomotionState.VelocityYawAngle = UE_REAL_TO_FLOAT(UAlsMath::DirectionToAngleXY(LocomotionState.Velocity));
+		LocomotionState.VelocityYawAngle = UE_REAL_TO_FLOAT(UAlsMath::DirectionToAngleXY(Velocity));
 	}
 
-	LocomotionState.Acceleration = (LocomotionState.Velocity - LocomotionState.PreviousVelocity) / DeltaTime;
-
 	// Character is moving if has speed and current acceleration, or if the speed is greater than the moving speed threshold.
 
 	// ReSharper disable once CppRedundantParentheses
@@ -1109,9 +1243,33 @@ void AAlsCharacter::FaceRotation(const FRotator NewRotation, const float DeltaTi
 	// Left empty intentionally.
 }
 
-void AAlsCharacter::CharacterMovement_OnPhysicsRotation(const float DeltaTime)
+void AAlsCharacter::RefreshFixedTimeStepRotation(const float DeltaTime)
 {
-	RefreshRollingPhysics(DeltaTime);
+	if (!IsValid(Settings) || !AnimationInstance.IsValid())
+	{
+		return;
+	}
+
+	// Only the locomotion state used by the rotation is refreshed here. The velocity, the acceleration
+	// and the view yaw speed are still refreshed once per frame, because they are calculated per frame.
+
+	RefreshLocomotionInputAndSpeed();
+
+	// Use the view rotation of this movement update instead of the view rotation of the last frame. The server replays
+	// each client move with the view rotation of that move, so this way both calculate the same rotation. The view
+	// state is restored afterwards, because on listen servers it contains the smoothed view rotation.
+
+	const auto FrameViewRotation{ViewState.Rotation};
+
+	if (!ViewFocusTarget.bValid)
+	{
+		ViewState.Rotation = Super::GetViewRotation().GetNormalized();
+	}
+
+	RefreshGroundedRotation(DeltaTime);
+	RefreshInAirRotation(DeltaTime);
+
+	ViewState.Rotation = FrameViewRotation;
 }
 
 void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
@@ -1270,8 +1428,7 @@ float AAlsCharacter::CalculateRotationInterpolationSpeed() const
 	static constexpr auto ReferenceViewYawSpeed{300.0f};
 	static constexpr auto InterpolationSpeedMultiplier{3.0f};
 
-	return AlsCharacterMovement->GetGaitSettings().RotationInterpolationSpeedCurve
-	                           ->GetFloatValue(AlsCharacterMovement->CalculateGaitAmount()) *
+	return AlsCharacterMovement->GetGaitSettings().CalculateRotationInterpolationSpeed(AlsCharacterMovement->CalculateGaitAmount()) *
 	       UAlsMath::LerpClamped(1.0f, InterpolationSpeedMultiplier, ViewState.YawSpeed / ReferenceViewYawSpeed);
 }
 
@@ -3,7 +3,6 @@
 #include "AlsCharacter.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "Curves/CurveVector.h"
 #include "GameFramework/Controller.h"
 #include "Utility/AlsMacros.h"
 
@@ -64,7 +63,13 @@ bool FAlsSavedMove::CanCombineWith(const FSavedMovePtr& NewMovePtr, ACharacter*
 {
 	const auto* NewMove{static_cast<FAlsSavedMove*>(NewMovePtr.Get())};
 
-	return RotationMode == NewMove->RotationMode &&
+	// Moves simulated in fixed time steps are not combined, because the client would simulate
+	// the combined move again with the combined delta time, which is not a fixed time step.
+
+	const auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
+
+	return (!IsValid(Movement) || !Movement->IsFixedTimeStepActive()) &&
+	       RotationMode == NewMove->RotationMode &&
 	       Stance == NewMove->Stance &&
 	       MaxAllowedGait == NewMove->MaxAllowedGait &&
 	       Super::CanCombineWith(NewMovePtr, Character, MaxDelta);
@@ -143,8 +148,6 @@ UAlsCharacterMovementComponent::UAlsCharacterMovementComponent()
 	bUseControllerDesiredRotation = false;
 	bOrientRotationToMovement = false;
 
-	bAllowPhysicsRotationDuringAnimRootMotion = true; // Used to allow character rotation while rolling.
-
 	NavAgentProps.bCanCrouch = true;
 	NavAgentProps.bCanFly = true;
 	bUseAccelerationForPaths = true;
@@ -171,6 +174,71 @@ void UAlsCharacterMovementComponent::BeginPlay()
 	Super::BeginPlay();
 }
 
+void UAlsCharacterMovementComponent::TickComponent(const float DeltaTime, const ELevelTick TickType,
+                                                   FActorComponentTickFunction* ThisTickFunction)
+{
+	if (!IsFixedTimeStepActive())
+	{
+		FixedTimeStepAccumulator = 0.0f;
+		FixedTimeStepsCount = 0;
+
+		if (!FixedTimeStepMeshOffset.IsZero() && HasValidData())
+		{
+			FixedTimeStepMeshOffset = FVector::ZeroVector;
+			CharacterOwner->GetMesh()->SetRelativeLocation(CharacterOwner->GetBaseTranslationOffset());
+		}
+
+		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+		return;
+	}
+
+	FixedTimeStepAccumulator += DeltaTime;
+	FixedTimeStepsCount = FMath::Min(FMath::FloorToInt(FixedTimeStepAccumulator / FixedTimeStep), MaxFixedTimeStepsPerFrame);
+	FixedTimeStepAccumulator = FMath::Min(FixedTimeStepAccumulator - FixedTimeStepsCount * FixedTimeStep, FixedTimeStep);
+
+	// Consume the input vector on every frame, even if no steps are simulated in it, so that it doesn't accumulate
+	// over several frames. Only the latest input is kept and added again before each step, because each step
+	// consumes the input vector.
+
+	const auto InputVector{ConsumeInputVector()};
+
+	for (auto i{0}; i < FixedTimeStepsCount; i++)
+	{
+		AddInputVector(InputVector, true);
+
+		FixedTimeStepPreviousLocation = UpdatedComponent->GetComponentLocation();
+
+		Super::TickComponent(FixedTimeStep, TickType, ThisTickFunction);
+	}
+
+	RefreshFixedTimeStepMeshOffset();
+}
+
+void UAlsCharacterMovementComponent::OnTeleported()
+{
+	Super::OnTeleported();
+
+	if (HasValidData())
+	{
+		FixedTimeStepPreviousLocation = UpdatedComponent->GetComponentLocation();
+	}
+}
+
+void UAlsCharacterMovementComponent::RefreshFixedTimeStepMeshOffset()
+{
+	// Interpolate the mesh between the last two simulated steps by the remaining accumulated time. The camera follows
+	// the mesh, so it is interpolated too. Rotation is not interpolated because the character rotation is applied
+	// directly to the mesh by the animation instance.
+
+	const auto Location{UpdatedComponent->GetComponentLocation()};
+	const auto InterpolationAmount{FixedTimeStepAccumulator / FixedTimeStep};
+
+	FixedTimeStepMeshOffset = UpdatedComponent->GetComponentQuat().UnrotateVector(
+		FMath::Lerp(FixedTimeStepPreviousLocation, Location, InterpolationAmount) - Location);
+
+	CharacterOwner->GetMesh()->SetRelativeLocation(CharacterOwner->GetBaseTranslationOffset() + FixedTimeStepMeshOffset);
+}
+
 void UAlsCharacterMovementComponent::SetMovementMode(const EMovementMode NewMovementMode, const uint8 NewCustomMode)
 {
 	if (!bMovementModeLocked)
@@ -194,7 +262,7 @@ float UAlsCharacterMovementComponent::GetMaxAcceleration() const
 	// Get the acceleration using the movement curve. This allows for fine control over movement behavior at each speed.
 
 	return IsMovingOnGround() && ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
-		       ? GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].Eval(CalculateGaitAmount())
+		       ? GaitSettings.CalculateMaxAcceleration(CalculateGaitAmount())
 		       : Super::GetMaxAcceleration();
 }
 
@@ -203,7 +271,7 @@ float UAlsCharacterMovementComponent::GetMaxBrakingDeceleration() const
 	// Get the deceleration using the movement curve. This allows for fine control over movement behavior at each speed.
 
 	return IsMovingOnGround() && ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
-		       ? GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[1].Eval(CalculateGaitAmount())
+		       ? GaitSettings.CalculateMaxBrakingDeceleration(CalculateGaitAmount())
 		       : Super::GetMaxBrakingDeceleration();
 }
 
@@ -218,23 +286,13 @@ void UAlsCharacterMovementComponent::ControlledCharacterMove(const FVector& Inpu
 	}
 }
 
-void UAlsCharacterMovementComponent::PhysicsRotation(const float DeltaTime)
-{
-	Super::PhysicsRotation(DeltaTime);
-
-	if (HasValidData() && (bRunPhysicsWithNoController || IsValid(CharacterOwner->Controller)))
-	{
-		OnPhysicsRotation.Broadcast(DeltaTime);
-	}
-}
-
 void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 Iterations)
 {
 	if (ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve)))
 	{
 		// Get the ground friction using the movement curve. This allows for fine control over movement behavior at each speed.
 
-		GroundFriction = GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(CalculateGaitAmount());
+		GroundFriction = GaitSettings.CalculateGroundFriction(CalculateGaitAmount());
 	}
 
 	// TODO Copied with modifications from UCharacterMovementComponent::PhysWalking().
@@ -479,7 +537,7 @@ void UAlsCharacterMovementComponent::PhysNavWalking(const float DeltaTime, const
 	{
 		// Get the ground friction using the movement curve. This allows for fine control over movement behavior at each speed.
 
-		GroundFriction = GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(CalculateGaitAmount());
+		GroundFriction = GaitSettings.CalculateGroundFriction(CalculateGaitAmount());
 	}
 
 	Super::PhysNavWalking(DeltaTime, Iterations);
@@ -514,6 +572,19 @@ void UAlsCharacterMovementComponent::PerformMovement(const float DeltaTime)
 {
 	Super::PerformMovement(DeltaTime);
 
+	// Refresh the character rotation after each movement update, so that the server calculates the same rotation as
+	// the client while replaying its moves. Moves replayed by the client after a correction don't refresh the rotation,
+	// because the rotation of the character is not corrected by the server and was already refreshed for these moves.
+
+	if (HasValidData() && !CharacterOwner->bClientUpdating && IsFixedTimeStepRotationActive())
+	{
+		auto* Character{Cast<AAlsCharacter>(CharacterOwner)};
+		if (IsValid(Character))
+		{
+			Character->RefreshFixedTimeStepRotation(DeltaTime);
+		}
+	}
+
 	// Update the ServerLastTransformUpdateTimeStamp when the control rotation
 	// changes. This is required for the view network smoothing to work properly.
 
@@ -578,7 +649,27 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 		RefreshGaitSettings();
 	}
 
-	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAcceleration);
+	// Replay moves of clients that simulate fixed time steps with the same steps. The server calculates the delta time
+	// of a move from the client time stamps, so it differs slightly from a whole number of steps due to rounding errors.
+
+	static constexpr auto FixedTimeStepTolerance{0.01f};
+
+	const auto FixedTimeStepsCountInMove{
+		bUseFixedTimeStep && FixedTimeStep > 0.0f ? FMath::RoundToInt(DeltaTime / FixedTimeStep) : 0
+	};
+
+	if (FixedTimeStepsCountInMove > 0 &&
+	    FMath::IsNearlyEqual(DeltaTime, FixedTimeStepsCountInMove * FixedTimeStep, FixedTimeStep * FixedTimeStepTolerance))
+	{
+		for (auto i{0}; i < FixedTimeStepsCountInMove; i++)
+		{
+			Super::MoveAutonomous(ClientTimeStamp, FixedTimeStep, CompressedFlags, NewAcceleration);
+		}
+	}
+	else
+	{
+		Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAcceleration);
+	}
 
 	// Process view network smoothing on the listen server.
 
@@ -785,7 +876,12 @@ void UAlsCharacterMovementComponent::RefreshGaitSettings()
 {
 	if (ALS_ENSURE(IsValid(MovementSettings)))
 	{
-		GaitSettings = *MovementSettings->RotationModes.Find(RotationMode)->Stances.Find(Stance);
+		const auto* NewGaitSettings{MovementSettings->FindGaitSettings(RotationMode, Stance)};
+		if (ALS_ENSURE_MESSAGE(NewGaitSettings != nullptr, TEXT("%s has no gait settings for the %s rotation mode and the %s stance."),
+		                       *MovementSettings->GetPathName(), *RotationMode.ToString(), *Stance.ToString()))
+		{
+			GaitSettings = *NewGaitSettings;
+		}
 	}
 
 	RefreshMaxWalkSpeed();
@@ -827,31 +923,26 @@ void UAlsCharacterMovementComponent::RefreshMaxWalkSpeed()
 	MaxWalkSpeedCrouched = MaxWalkSpeed;
 }
 
-float UAlsCharacterMovementComponent::CalculateGaitAmount() const
+void UAlsCharacterMovementComponent::SetUseFixedTimeStep(const bool bNewUseFixedTimeStep)
 {
-	// Map the character's current speed to the configured movement speeds ranging from 0 to 3,
-	// where 0 is stopped, 1 is walking, 2 is running, and 3 is sprinting. This allows us to vary
-	// movement speeds but still use the mapped range in calculations for consistent results.
-
-	const auto Speed{UE_REAL_TO_FLOAT(Velocity.Size2D())};
-
-	if (Speed <= GaitSettings.WalkSpeed)
-	{
-		static const FVector2f GaitAmount{0.0f, 1.0f};
-
-		return FMath::GetMappedRangeValueClamped({0.0f, GaitSettings.WalkSpeed}, GaitAmount, Speed);
-	}
-
-	if (Speed <= GaitSettings.RunSpeed)
-	{
-		static const FVector2f GaitAmount{1.0f, 2.0f};
+	bUseFixedTimeStep = bNewUseFixedTimeStep;
+}
 
-		return FMath::GetMappedRangeValueClamped({GaitSettings.WalkSpeed, GaitSettings.RunSpeed}, GaitAmount, Speed);
-	}
+bool UAlsCharacterMovementComponent::IsFixedTimeStepActive() const
+{
+	return bUseFixedTimeStep && FixedTimeStep > 0.0f && HasValidData() && CharacterOwner->IsLocallyControlled();
+}
 
-	static const FVector2f GaitAmount{2.0f, 3.0f};
+bool UAlsCharacterMovementComponent::IsFixedTimeStepRotationActive() const
+{
+	return IsFixedTimeStepActive() ||
+	       (bUseFixedTimeStep && FixedTimeStep > 0.0f && HasValidData() &&
+	        CharacterOwner->GetLocalRole() >= ROLE_Authority && CharacterOwner->GetRemoteRole() == ROLE_AutonomousProxy);
+}
 
-	return FMath::GetMappedRangeValueClamped({GaitSettings.RunSpeed, GaitSettings.SprintSpeed}, GaitAmount, Speed);
+float UAlsCharacterMovementComponent::CalculateGaitAmount() const
+{
+	return GaitSettings.CalculateGaitAmount(UE_REAL_TO_FLOAT(Velocity.Size2D()));
 }
 
 void UAlsCharacterMovementComponent::SetMovementModeLocked(const bool bNewMovementModeLocked)
@@ -4,8 +4,10 @@
 #include "AlsCharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Curves/CurveVector.h"
+#include "Engine/DemoNetDriver.h"
 #include "Engine/NetConnection.h"
 #include "RootMotionSources/AlsRootMotionSource_Mantling.h"
+#include "RootMotionSources/AlsRootMotionSource_Rolling.h"
 #include "Settings/AlsCharacterSettings.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
@@ -64,16 +66,137 @@ UAnimMontage* AAlsCharacter::SelectRollMontage_Implementation()
 	return Settings->Rolling.Montage;
 }
 
+bool AAlsCharacter::IsRollMontageAllowed_Implementation(UAnimMontage* Montage)
+{
+	return IsValid(Montage) &&
+	       (Montage == Settings->Rolling.Montage || Settings->Rolling.AdditionalMontages.Contains(Montage) ||
+	        Montage == SelectRollMontage());
+}
+
 void AAlsCharacter::ServerStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
                                                       const float StartYawAngle, const float TargetYawAngle)
 {
-	if (IsRollingAllowedToStart(Montage))
+	if (IsValid(RollingState.PendingMontage))
 	{
-		MulticastStartRolling(Montage, PlayRate, StartYawAngle, TargetYawAngle);
-		ForceNetUpdate();
+		// The new request supersedes the pending one.
+
+		auto* PendingMontage{RollingState.PendingMontage.Get()};
+		RollingState.PendingMontage = nullptr;
+
+		ClientCancelRolling(PendingMontage);
+	}
+
+	if (LocomotionMode == AlsLocomotionModeTags::InAir && Settings->Rolling.bStartRollingOnLand)
+	{
+		// Most likely the client started rolling on landing, but the server hasn't processed the landing move
+		// yet, because it is sent after this request, so postpone the validation until the character lands.
+
+		RollingState.PendingMontage = Montage;
+		RollingState.PendingPlayRate = PlayRate;
+		RollingState.PendingStartYawAngle = StartYawAngle;
+		RollingState.PendingTargetYawAngle = TargetYawAngle;
+		RollingState.PendingRequestTime = GetWorld()->GetTimeSeconds();
+		return;
+	}
+
+	StartClientRolling(Montage, PlayRate, StartYawAngle, TargetYawAngle);
+}
+
+void AAlsCharacter::StartClientRolling(UAnimMontage* Montage, const float PlayRate, const float StartYawAngle, const float TargetYawAngle)
+{
+	// Don't trust the client and validate the rolling against the server state. Invalid requests are
+	// rejected, and yaw angles that are too far from the expected ones are replaced with the server ones.
+
+	if (LocomotionMode != AlsLocomotionModeTags::Grounded || !IsRollMontageAllowed(Montage) ||
+	    !FMath::IsFinite(PlayRate) || PlayRate <= 0.0f || !IsRollingAllowedToStart(Montage))
+	{
+		ClientCancelRolling(Montage);
+		return;
+	}
+
+	const auto ActorYawAngle{UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(GetActorRotation().Yaw))};
+
+	const auto IsYawAngleNearlyEqual{
+		[YawAngleTolerance = Settings->Rolling.ServerYawAngleTolerance](const float YawAngle, const float ExpectedYawAngle)
+		{
+			return FMath::IsFinite(YawAngle) &&
+			       FMath::Abs(FRotator::NormalizeAxis(YawAngle - ExpectedYawAngle)) <= YawAngleTolerance;
+		}
+	};
+
+	// The target yaw angle is either the input, velocity, or actor yaw angle, depending on how the rolling was started.
+
+	const auto bTargetYawAngleValid{
+		IsYawAngleNearlyEqual(TargetYawAngle, ActorYawAngle) ||
+		(LocomotionState.bHasInput && IsYawAngleNearlyEqual(TargetYawAngle, LocomotionState.InputYawAngle)) ||
+		(LocomotionState.bHasSpeed && IsYawAngleNearlyEqual(TargetYawAngle, LocomotionState.VelocityYawAngle))
+	};
+
+	MulticastStartRolling(Montage, FMath::Min(PlayRate, Settings->Rolling.MaxPlayRate),
+	                      IsYawAngleNearlyEqual(StartYawAngle, ActorYawAngle) ? StartYawAngle : ActorYawAngle,
+	                      bTargetYawAngleValid ? TargetYawAngle : ActorYawAngle);
+	ForceNetUpdate();
+}
+
+void AAlsCharacter::RefreshPendingClientRolling()
+{
+	if (!IsValid(RollingState.PendingMontage))
+	{
+		return;
+	}
+
+	// The landing move follows the request closely, so if the character is still in the air after this time,
+	// then the client most likely didn't land at all, and the request is no longer worth waiting for.
+
+	static constexpr auto PendingRequestTimeout{0.5f};
+
+	const auto bRequestExpired{GetWorld()->GetTimeSeconds() - RollingState.PendingRequestTime > PendingRequestTimeout};
+
+	if (LocomotionMode == AlsLocomotionModeTags::InAir && !bRequestExpired)
+	{
+		return;
+	}
+
+	auto* Montage{RollingState.PendingMontage.Get()};
+	RollingState.PendingMontage = nullptr;
+
+	// The request is accepted only if the character just landed with the same speed the client started rolling with.
+
+	if (!bRequestExpired && LocomotionMode == AlsLocomotionModeTags::Grounded &&
+	    LocomotionState.Velocity.Z <= -Settings->Rolling.RollingOnLandSpeedThreshold)
+	{
+		StartClientRolling(Montage, RollingState.PendingPlayRate, RollingState.PendingStartYawAngle, RollingState.PendingTargetYawAngle);
+	}
+	else
+	{
+		ClientCancelRolling(Montage);
 	}
 }
 
+void AAlsCharacter::ClientCancelRolling_Implementation(UAnimMontage* Montage)
+{
+	if (!IsValid(Montage))
+	{
+		return;
+	}
+
+	// The client may have started another rolling since the rejected request, so leave it alone.
+
+	if (RollingRootMotionSourceId > 0)
+	{
+		const auto RootMotionSource{GetCharacterMovement()->GetRootMotionSourceByID(RollingRootMotionSourceId)};
+
+		if (RootMotionSource.IsValid() && static_cast<FAlsRootMotionSource_Rolling*>(RootMotionSource.Get())->Montage != Montage)
+		{
+			return;
+		}
+
+		StopRolling();
+	}
+
+	GetMesh()->GetAnimInstance()->Montage_Stop(Montage->BlendOut.GetBlendTime(), Montage);
+}
+
 void AAlsCharacter::MulticastStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
                                                          const float StartYawAngle, const float TargetYawAngle)
 {
@@ -83,51 +206,76 @@ void AAlsCharacter::MulticastStartRolling_Implementation(UAnimMontage* Montage,
 void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const float PlayRate,
                                                const float StartYawAngle, const float TargetYawAngle)
 {
-	if (IsRollingAllowedToStart(Montage) && GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate))
+	if (!IsRollingAllowedToStart(Montage) || !GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate))
 	{
-		RollingState.TargetYawAngle = TargetYawAngle;
+		return;
+	}
 
-		RefreshRotationInstant(StartYawAngle);
+	// Disable the montage root motion because it is applied by the rolling root motion source instead.
 
-		SetLocomotionAction(AlsLocomotionActionTags::Rolling);
+	auto* MontageInstance{GetMesh()->GetAnimInstance()->GetActiveInstanceForMontage(Montage)};
+	if (MontageInstance != nullptr)
+	{
+		MontageInstance->PushDisableRootMotion();
 	}
+
+	RollingState.TargetYawAngle = TargetYawAngle;
+
+	RefreshRotationInstant(StartYawAngle);
+
+	// Remove the root motion source of the previous rolling, if it's still active.
+
+	StopRolling();
+
+	const auto Rolling{MakeShared<FAlsRootMotionSource_Rolling>()};
+	Rolling->InstanceName = __FUNCTION__;
+	Rolling->Duration = Montage->GetPlayLength() / PlayRate;
+	Rolling->Montage = Montage;
+	Rolling->PlayRate = PlayRate;
+	Rolling->StartYawAngle = StartYawAngle;
+	Rolling->TargetYawAngle = TargetYawAngle;
+	Rolling->RotationInterpolationSpeed = Settings->Rolling.RotationInterpolationSpeed;
+
+	RollingRootMotionSourceId = GetCharacterMovement()->ApplyRootMotionSource(Rolling);
+
+	SetLocomotionAction(AlsLocomotionActionTags::Rolling);
 }
 
-void AAlsCharacter::RefreshRolling(const float DeltaTime)
+void AAlsCharacter::RefreshRolling()
 {
-	if (GetLocalRole() <= ROLE_SimulatedProxy ||
-	    GetMesh()->GetAnimInstance()->RootMotionMode <= ERootMotionMode::IgnoreRootMotion)
+	if (RollingRootMotionSourceId <= 0)
 	{
-		// Refresh rolling physics here because AAlsCharacter::PhysicsRotation()
-		// won't be called on simulated proxies or with ignored root motion.
+		return;
+	}
 
-		RefreshRollingPhysics(DeltaTime);
+	const auto RootMotionSource{GetCharacterMovement()->GetRootMotionSourceByID(RollingRootMotionSourceId)};
+
+	if (!RootMotionSource.IsValid() ||
+	    RootMotionSource->Status.HasFlag(ERootMotionSourceStatusFlags::Finished) ||
+	    RootMotionSource->Status.HasFlag(ERootMotionSourceStatusFlags::MarkedForRemoval) ||
+	    LocomotionAction != AlsLocomotionActionTags::Rolling)
+	{
+		StopRolling();
 	}
 }
 
-void AAlsCharacter::RefreshRollingPhysics(const float DeltaTime)
+void AAlsCharacter::StopRolling()
 {
-	if (LocomotionAction != AlsLocomotionActionTags::Rolling)
+	if (RollingRootMotionSourceId <= 0)
 	{
 		return;
 	}
 
-	auto TargetRotation{GetCharacterMovement()->UpdatedComponent->GetComponentRotation()};
+	const auto RootMotionSource{GetCharacterMovement()->GetRootMotionSourceByID(RollingRootMotionSourceId)};
 
-	if (Settings->Rolling.RotationInterpolationSpeed <= 0.0f)
+	if (RootMotionSource.IsValid() &&
+	    !RootMotionSource->Status.HasFlag(ERootMotionSourceStatusFlags::Finished) &&
+	    !RootMotionSource->Status.HasFlag(ERootMotionSourceStatusFlags::MarkedForRemoval))
 	{
-		TargetRotation.Yaw = RollingState.TargetYawAngle;
-
-		GetCharacterMovement()->MoveUpdatedComponent(FVector::ZeroVector, TargetRotation, false, nullptr, ETeleportType::TeleportPhysics);
+		RootMotionSource->Status.SetFlag(ERootMotionSourceStatusFlags::MarkedForRemoval);
 	}
-	else
-	{
-		TargetRotation.Yaw = UAlsMath::ExponentialDecayAngle(UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(TargetRotation.Yaw)),
-		                                                     RollingState.TargetYawAngle, DeltaTime,
-		                                                     Settings->Rolling.RotationInterpolationSpeed);
 
-		GetCharacterMovement()->MoveUpdatedComponent(FVector::ZeroVector, TargetRotation, false);
-	}
+	RollingRootMotionSourceId = 0;
 }
 
 bool AAlsCharacter::TryStartMantlingGrounded()
@@ -154,7 +302,6 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 		return false;
 	}
 
-	const auto ActorLocation{GetActorLocation()};
 	const auto ActorYawAngle{UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(GetActorRotation().Yaw))};
 
 	float ForwardTraceAngle;
@@ -177,21 +324,56 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 		return false;
 	}
 
+	const auto ForwardTraceDirection{
+		UAlsMath::AngleToDirectionXY(
+			ActorYawAngle + FMath::ClampAngle(ForwardTraceDeltaAngle, -Settings->Mantling.MaxReachAngle, Settings->Mantling.MaxReachAngle))
+	};
+
+	FAlsMantlingParameters Parameters;
+	FVector TargetLocation;
+
+	if (!TraceMantlingTarget(TraceSettings, ForwardTraceDirection, Parameters, TargetLocation))
+	{
+		return false;
+	}
+
+	// Determine the mantling type by checking the movement mode and mantling height.
+
+	Parameters.MantlingType = LocomotionMode != AlsLocomotionModeTags::Grounded
+		                          ? EAlsMantlingType::InAir
+		                          : Parameters.MantlingHeight > Settings->Mantling.MantlingHighHeightThreshold
+		                          ? EAlsMantlingType::High
+		                          : EAlsMantlingType::Low;
+
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		MulticastStartMantling(Parameters);
+	}
+	else
+	{
+		GetCharacterMovement()->FlushServerMoves();
+
+		StartMantlingImplementation(Parameters);
+		ServerStartMantling(Parameters);
+	}
+
+	return true;
+}
+
+bool AAlsCharacter::TraceMantlingTarget(const FAlsMantlingTraceSettings& TraceSettings, const FVector& ForwardTraceDirection,
+                                        FAlsMantlingParameters& Parameters, FVector& TargetLocation)
+{
 	FCollisionObjectQueryParams ObjectQueryParameters;
 	for (const auto ObjectType : Settings->Mantling.MantlingTraceObjectTypes)
 	{
 		ObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
 	}
 
-	const auto ForwardTraceDirection{
-		UAlsMath::AngleToDirectionXY(
-			ActorYawAngle + FMath::ClampAngle(ForwardTraceDeltaAngle, -Settings->Mantling.MaxReachAngle, Settings->Mantling.MaxReachAngle))
-	};
-
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebug{UAlsUtility::ShouldDisplayDebugForActor(this, UAlsConstants::MantlingDisplayName())};
 #endif
 
+	const auto ActorLocation{GetActorLocation()};
 	const auto* Capsule{GetCapsuleComponent()};
 
 	const auto CapsuleScale{Capsule->GetComponentScale().Z};
@@ -290,11 +472,9 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 
 	static const FName FreeSpaceTraceTag{__FUNCTION__ TEXT(" (Free Space Overlap)")};
 
-	const FVector TargetLocation{
-		DownwardTraceHit.ImpactPoint.X,
-		DownwardTraceHit.ImpactPoint.Y,
-		DownwardTraceHit.ImpactPoint.Z + UCharacterMovementComponent::MIN_FLOOR_DIST
-	};
+	TargetLocation.X = DownwardTraceHit.ImpactPoint.X;
+	TargetLocation.Y = DownwardTraceHit.ImpactPoint.Y;
+	TargetLocation.Z = DownwardTraceHit.ImpactPoint.Z + UCharacterMovementComponent::MIN_FLOOR_DIST;
 
 	const FVector TargetCapsuleLocation{TargetLocation.X, TargetLocation.Y, TargetLocation.Z + CapsuleHalfHeight};
 
@@ -336,19 +516,9 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 
 	const auto TargetRotation{(-ForwardTraceHit.ImpactNormal.GetSafeNormal2D()).ToOrientationQuat()};
 
-	FAlsMantlingParameters Parameters;
-
 	Parameters.TargetPrimitive = TargetPrimitive;
 	Parameters.MantlingHeight = UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocation.Z) / CapsuleScale);
 
-	// Determine the mantling type by checking the movement mode and mantling height.
-
-	Parameters.MantlingType = LocomotionMode != AlsLocomotionModeTags::Grounded
-		                          ? EAlsMantlingType::InAir
-		                          : Parameters.MantlingHeight > Settings->Mantling.MantlingHighHeightThreshold
-		                          ? EAlsMantlingType::High
-		                          : EAlsMantlingType::Low;
-
 	// If the target primitive can't move, then use world coordinates to save
 	// some performance by skipping some coordinate space transformations later.
 
@@ -367,27 +537,151 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 		Parameters.TargetRelativeRotation = TargetRotation.Rotator();
 	}
 
-	if (GetLocalRole() >= ROLE_Authority)
+	return true;
+}
+
+void AAlsCharacter::ServerStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
+{
+	if (!IsMantlingAllowedToStart())
 	{
-		MulticastStartMantling(Parameters);
+		return;
 	}
-	else
+
+	if (Settings->Mantling.bValidateOnServer && !IsMantlingParametersValid(Parameters))
 	{
-		GetCharacterMovement()->FlushServerMoves();
+		ClientCancelMantling(Parameters.MantlingType);
+		return;
+	}
 
-		StartMantlingImplementation(Parameters);
-		ServerStartMantling(Parameters);
+	MulticastStartMantling(Parameters);
+	ForceNetUpdate();
+}
+
+bool AAlsCharacter::IsMantlingParametersValid(const FAlsMantlingParameters& Parameters)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::IsMantlingParametersValid()"),
+	                            STAT_AAlsCharacter_IsMantlingParametersValid, STATGROUP_Als)
+
+	// Unlike the client, the server doesn't repeat the full ledge search, but uses a fixed budget
+	// of one sweep and one overlap to check that the client's target is reachable and standable.
+
+	const auto& MantlingSettings{Settings->Mantling};
+	const auto Tolerance{MantlingSettings.ServerValidationTolerance};
+
+	if (!MantlingSettings.bAllowMantling ||
+	    !FMath::IsFinite(Parameters.MantlingHeight) ||
+	    Parameters.TargetRelativeLocation.ContainsNaN() ||
+	    Parameters.TargetRelativeRotation.ContainsNaN())
+	{
+		return false;
 	}
 
-	return true;
+	// Check the mantling type against the server locomotion mode.
+
+	const auto bInAir{Parameters.MantlingType == EAlsMantlingType::InAir};
+
+	if (bInAir != (LocomotionMode == AlsLocomotionModeTags::InAir) ||
+	    (Parameters.MantlingType == EAlsMantlingType::High &&
+	     Parameters.MantlingHeight < MantlingSettings.MantlingHighHeightThreshold - Tolerance) ||
+	    (Parameters.MantlingType == EAlsMantlingType::Low &&
+	     Parameters.MantlingHeight > MantlingSettings.MantlingHighHeightThreshold + Tolerance))
+	{
+		return false;
+	}
+
+	auto* TargetPrimitive{Parameters.TargetPrimitive.Get()};
+
+	if (IsValid(TargetPrimitive) &&
+	    (TargetPrimitive->GetComponentVelocity().SizeSquared() > FMath::Square(MantlingSettings.TargetPrimitiveSpeedThreshold) ||
+	     !TargetPrimitive->CanCharacterStepUp(this)))
+	{
+		return false;
+	}
+
+	const auto TargetLocation{
+		MovementBaseUtility::UseRelativeLocation(TargetPrimitive)
+			? TargetPrimitive->GetComponentTransform().TransformPosition(Parameters.TargetRelativeLocation)
+			: FVector{Parameters.TargetRelativeLocation}
+	};
+
+	const auto ActorLocation{GetActorLocation()};
+	const auto* Capsule{GetCapsuleComponent()};
+
+	const auto CapsuleScale{Capsule->GetComponentScale().Z};
+	const auto CapsuleRadius{Capsule->GetScaledCapsuleRadius()};
+	const auto CapsuleHalfHeight{Capsule->GetScaledCapsuleHalfHeight()};
+
+	const auto CapsuleBottomLocationZ{ActorLocation.Z - CapsuleHalfHeight};
+
+	// Check that the mantling height matches the target location and is within the ledge height range.
+
+	const auto& TraceSettings{bInAir ? MantlingSettings.InAirTrace : MantlingSettings.GroundedTrace};
+	const auto MantlingHeight{UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocationZ) / CapsuleScale)};
+
+	if (FMath::Abs(MantlingHeight - Parameters.MantlingHeight) > Tolerance ||
+	    MantlingHeight < TraceSettings.LedgeHeight.GetMin() - Tolerance ||
+	    MantlingHeight > TraceSettings.LedgeHeight.GetMax() + Tolerance)
+	{
+		return false;
+	}
+
+	// Check that the target location is within the reach distance.
+
+	const auto MaxReachDistance{
+		CapsuleRadius + (TraceSettings.ReachDistance + TraceSettings.TargetLocationOffset) * CapsuleScale + Tolerance
+	};
+
+	if (FVector::DistSquared2D(ActorLocation, TargetLocation) > FMath::Square(MaxReachDistance))
+	{
+		return false;
+	}
+
+	FCollisionObjectQueryParams ObjectQueryParameters;
+	for (const auto ObjectType : MantlingSettings.MantlingTraceObjectTypes)
+	{
+		ObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
+	}
+
+	// Check that the target surface exists, belongs to the target primitive, and is walkable.
+
+	static const FName DownwardTraceTag{__FUNCTION__ TEXT(" (Downward Trace)")};
+
+	const auto TraceCapsuleRadius{CapsuleRadius - 1.0f};
+
+	const FVector DownwardTraceStart{TargetLocation.X, TargetLocation.Y, TargetLocation.Z + TraceCapsuleRadius + Tolerance};
+	const FVector DownwardTraceEnd{TargetLocation.X, TargetLocation.Y, TargetLocation.Z + TraceCapsuleRadius - Tolerance};
+
+	FHitResult DownwardTraceHit;
+	GetWorld()->SweepSingleByObjectType(DownwardTraceHit, DownwardTraceStart, DownwardTraceEnd, FQuat::Identity,
+	                                    ObjectQueryParameters, FCollisionShape::MakeSphere(TraceCapsuleRadius),
+	                                    {DownwardTraceTag, false, this});
+
+	if (!GetCharacterMovement()->IsWalkable(DownwardTraceHit) ||
+	    // ReSharper disable once CppRedundantParentheses
+	    (IsValid(TargetPrimitive) && DownwardTraceHit.GetComponent() != TargetPrimitive))
+	{
+		return false;
+	}
+
+	// Check that the capsule has room to stand at the target location.
+
+	static const FName FreeSpaceTraceTag{__FUNCTION__ TEXT(" (Free Space Overlap)")};
+
+	return !GetWorld()->OverlapAnyTestByObjectType({TargetLocation.X, TargetLocation.Y, TargetLocation.Z + CapsuleHalfHeight},
+	                                               FQuat::Identity, ObjectQueryParameters,
+	                                               FCollisionShape::MakeCapsule(CapsuleRadius, CapsuleHalfHeight),
+	                                               {FreeSpaceTraceTag, false, this});
 }
 
-void AAlsCharacter::ServerStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
+void AAlsCharacter::ClientCancelMantling_Implementation(const EAlsMantlingType MantlingType)
 {
-	if (IsMantlingAllowedToStart())
+	StopMantling();
+
+	const auto* MantlingSettings{SelectMantlingSettings(MantlingType)};
+
+	if (IsValid(MantlingSettings) && IsValid(MantlingSettings->Montage))
 	{
-		MulticastStartMantling(Parameters);
-		ForceNetUpdate();
+		GetMesh()->GetAnimInstance()->Montage_Stop(MantlingSettings->Montage->BlendOut.GetBlendTime(), MantlingSettings->Montage);
 	}
 }
 
@@ -888,3 +1182,114 @@ UAnimMontage* AAlsCharacter::SelectGetUpMontage_Implementation(const bool bRagdo
 }
 
 void AAlsCharacter::OnRagdollingEnded_Implementation() {}
+
+void AAlsCharacter::RefreshReplayState(const float DeltaTime)
+{
+	const auto* DemoNetDriver{GetWorld()->GetDemoNetDriver()};
+
+	if (GetLocalRole() < ROLE_Authority || !IsValid(DemoNetDriver) || !DemoNetDriver->IsRecording())
+	{
+		return;
+	}
+
+	ReplayStateUpdateTimeRemaining -= DeltaTime;
+
+	if (ReplayStateUpdateTimeRemaining > 0.0f && ReplayState.LocomotionAction == LocomotionAction)
+	{
+		return;
+	}
+
+	ReplayStateUpdateTimeRemaining = Settings->ReplayStateUpdateInterval;
+
+	ReplayState.LocomotionAction = LocomotionAction;
+
+	const auto* AnimationInstance{GetMesh()->GetAnimInstance()};
+	auto* ActionMontage{LocomotionAction.IsValid() ? AnimationInstance->GetCurrentActiveMontage() : nullptr};
+
+	ReplayState.ActionMontage = ActionMontage;
+	ReplayState.ActionMontagePosition = IsValid(ActionMontage) ? AnimationInstance->Montage_GetPosition(ActionMontage) : 0.0f;
+
+	if (LocomotionAction == AlsLocomotionActionTags::Ragdolling)
+	{
+		ReplayState.RagdollPelvisLocation = GetMesh()->GetSocketLocation(UAlsConstants::PelvisBoneName());
+	}
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplayState, this)
+}
+
+void AAlsCharacter::OnReplicated_ReplayState()
+{
+	const auto* DemoNetDriver{GetWorld()->GetDemoNetDriver()};
+
+	if (!IsValid(DemoNetDriver) || !DemoNetDriver->IsPlaying())
+	{
+		return;
+	}
+
+	// Stop ragdolling if the replay was scrubbed to a moment before or after it.
+
+	if (LocomotionAction == AlsLocomotionActionTags::Ragdolling &&
+	    ReplayState.LocomotionAction != AlsLocomotionActionTags::Ragdolling)
+	{
+		StopRagdollingImplementation();
+	}
+
+	if (ReplayState.LocomotionAction == AlsLocomotionActionTags::Ragdolling)
+	{
+		if (LocomotionAction != AlsLocomotionActionTags::Ragdolling)
+		{
+			StartRagdollingImplementation();
+
+			// Move the newly started ragdoll to the recorded location.
+
+			GetMesh()->AddWorldOffset(ReplayState.RagdollPelvisLocation - GetMesh()->GetSocketLocation(UAlsConstants::PelvisBoneName()),
+			                          false, nullptr, ETeleportType::TeleportPhysics);
+		}
+
+		return;
+	}
+
+	auto* AnimationInstance{GetMesh()->GetAnimInstance()};
+
+	if (!ReplayState.LocomotionAction.IsValid())
+	{
+		// Stop the locomotion action if the replay was scrubbed to a moment
+		// outside of it, since nothing else is going to stop its montage.
+
+		if (LocomotionAction.IsValid())
+		{
+			auto* ActionMontage{AnimationInstance->GetCurrentActiveMontage()};
+			if (IsValid(ActionMontage))
+			{
+				AnimationInstance->Montage_Stop(ActionMontage->BlendOut.GetBlendTime(), ActionMontage);
+			}
+
+			SetLocomotionAction(FGameplayTag::EmptyTag);
+		}
+
+		return;
+	}
+
+	if (!IsValid(ReplayState.ActionMontage))
+	{
+		return;
+	}
+
+	// Restore the locomotion action montage if it was missed or is too far from the recorded position.
+
+	static constexpr auto MontagePositionTolerance{0.25f};
+
+	if (!AnimationInstance->Montage_IsPlaying(ReplayState.ActionMontage))
+	{
+		if (AnimationInstance->Montage_Play(ReplayState.ActionMontage, 1.0f, EMontagePlayReturnType::MontageLength,
+		                                    ReplayState.ActionMontagePosition))
+		{
+			SetLocomotionAction(ReplayState.LocomotionAction);
+		}
+	}
+	else if (FMath::Abs(AnimationInstance->Montage_GetPosition(ReplayState.ActionMontage) -
+	                    ReplayState.ActionMontagePosition) > MontagePositionTolerance)
+	{
+		AnimationInstance->Montage_SetPosition(ReplayState.ActionMontage, ReplayState.ActionMontagePosition);
+	}
+}
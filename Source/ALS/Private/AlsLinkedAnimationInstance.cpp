@@ -44,3 +44,10 @@ void UAlsLinkedAnimationInstance::NativeBeginPlay()
 
 	Super::NativeBeginPlay();
 }
+
+const FAlsLinkedAnimationState& UAlsLinkedAnimationInstance::GetParentState() const
+{
+	static const FAlsLinkedAnimationState DefaultState;
+
+	return Parent.IsValid() ? Parent->GetLinkedState() : DefaultState;
+}
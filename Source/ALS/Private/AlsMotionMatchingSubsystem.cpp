@@ -0,0 +1,31 @@
+#include "AlsMotionMatchingSubsystem.h"
+
+bool UAlsMotionMatchingSubsystem::TryStartSearch(const int32 MaxSearchesPerFrame)
+{
+	if (MaxSearchesPerFrame <= 0)
+	{
+		return true;
+	}
+
+	// Animation instances are updated in parallel, so the counter is reset on the first search of
+	// a frame and incremented in a single atomic operation, without a separate frame number check.
+
+	const auto FrameNumber{static_cast<uint32>(GFrameCounter)};
+	auto Searches{FrameSearches.load(std::memory_order_relaxed)};
+
+	while (true)
+	{
+		const auto NumSearches{static_cast<uint32>(Searches >> 32) == FrameNumber ? static_cast<uint32>(Searches) : 0};
+
+		if (NumSearches >= static_cast<uint32>(MaxSearchesPerFrame))
+		{
+			return false;
+		}
+
+		if (FrameSearches.compare_exchange_weak(Searches, static_cast<uint64>(FrameNumber) << 32 | (NumSearches + 1),
+		                                        std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+}
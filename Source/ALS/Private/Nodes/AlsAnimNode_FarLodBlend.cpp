@@ -0,0 +1,121 @@
+#include "Nodes/AlsAnimNode_FarLodBlend.h"
+
+#include "AlsAnimationInstance.h"
+#include "AnimationRuntime.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "Animation/AnimSequenceBase.h"
+
+void FAlsAnimNode_FarLodBlend::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(Initialize_AnyThread)
+
+	Super::Initialize_AnyThread(Context);
+
+	SourcePose.Initialize(Context);
+
+	Sequence = nullptr;
+	Amount = 0.0f;
+	Time = 0.0f;
+}
+
+void FAlsAnimNode_FarLodBlend::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(CacheBones_AnyThread)
+
+	Super::CacheBones_AnyThread(Context);
+
+	SourcePose.CacheBones(Context);
+}
+
+void FAlsAnimNode_FarLodBlend::Update_AnyThread(const FAnimationUpdateContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(Update_AnyThread)
+
+	Super::Update_AnyThread(Context);
+
+	GetEvaluateGraphExposedInputs().Execute(Context);
+
+	// The far LOD state is only written on the game thread before the animation update, so it is safe to read it here.
+
+	const auto* AnimationInstance{Cast<UAlsAnimationInstance>(Context.AnimInstanceProxy->GetAnimInstanceObject())};
+	auto* NewSequence{IsValid(AnimationInstance) ? AnimationInstance->GetFarLodState().Sequence.Get() : nullptr};
+
+	if (IsValid(NewSequence) && NewSequence->GetPlayLength() > SMALL_NUMBER)
+	{
+		const auto& FarLodState{AnimationInstance->GetFarLodState()};
+
+		if (Sequence != NewSequence)
+		{
+			// Continue the new cycle from the same phase as the previous one, so that the feet don't pop.
+
+			Time = IsValid(Sequence) && Sequence->GetPlayLength() > SMALL_NUMBER
+				       ? Time / Sequence->GetPlayLength() * NewSequence->GetPlayLength()
+				       : 0.0f;
+
+			Sequence = NewSequence;
+		}
+
+		Amount = FarLodState.Amount;
+		Time = FMath::Fmod(Time + Context.GetDeltaTime() * FarLodState.PlayRate, Sequence->GetPlayLength());
+	}
+	else
+	{
+		Sequence = nullptr;
+		Amount = 0.0f;
+	}
+
+	if (!FAnimWeight::IsFullWeight(Amount))
+	{
+		SourcePose.Update(Context.FractionalWeight(1.0f - Amount));
+	}
+
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Amount"), Amount);
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Sequence"), Sequence.Get());
+}
+
+void FAlsAnimNode_FarLodBlend::Evaluate_AnyThread(FPoseContext& Output)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(Evaluate_AnyThread)
+
+	Super::Evaluate_AnyThread(Output);
+
+	if (!FAnimWeight::IsRelevant(Amount))
+	{
+		SourcePose.Evaluate(Output);
+		return;
+	}
+
+	if (FAnimWeight::IsFullWeight(Amount))
+	{
+		EvaluateCycle(Output);
+		return;
+	}
+
+	FPoseContext SourcePoseContext{Output};
+	SourcePose.Evaluate(SourcePoseContext);
+
+	FPoseContext CyclePoseContext{Output};
+	EvaluateCycle(CyclePoseContext);
+
+	const FAnimationPoseData SourcePoseData{SourcePoseContext};
+	const FAnimationPoseData CyclePoseData{CyclePoseContext};
+	FAnimationPoseData OutputPoseData{Output};
+
+	FAnimationRuntime::BlendTwoPosesTogether(SourcePoseData, CyclePoseData, 1.0f - Amount, OutputPoseData);
+}
+
+void FAlsAnimNode_FarLodBlend::GatherDebugData(FNodeDebugData& DebugData)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(GatherDebugData)
+
+	DebugData.AddDebugItem(FString::Printf(TEXT("%s: Amount: %.2f, Sequence: %s, Time: %.2f."), *DebugData.GetNodeName(this),
+	                                       Amount, *GetNameSafe(Sequence), Time));
+	SourcePose.GatherDebugData(DebugData.BranchFlow(1.0f - Amount));
+}
+
+void FAlsAnimNode_FarLodBlend::EvaluateCycle(FPoseContext& Output) const
+{
+	FAnimationPoseData OutputPoseData{Output};
+
+	Sequence->GetAnimationPose(OutputPoseData, {Time, false});
+}
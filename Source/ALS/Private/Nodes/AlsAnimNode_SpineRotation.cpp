@@ -0,0 +1,158 @@
+#include "Nodes/AlsAnimNode_SpineRotation.h"
+
+#include "Animation/AnimInstanceProxy.h"
+#include "Utility/AlsMath.h"
+
+static void RotateBoneChain(FComponentSpacePoseContext& Output, const TArray<FAlsSpineRotationBone>& Bones,
+                            const FVector& UpAxis, const FVector& RightAxis, const float YawAngle, const float PitchAngle,
+                            FTransform& ChainTransform, TArray<FBoneTransform>& OutBoneTransforms)
+{
+	auto TotalWeight{0.0f};
+
+	for (const auto& Bone : Bones)
+	{
+		TotalWeight += Bone.Weight;
+	}
+
+	if (TotalWeight <= SMALL_NUMBER)
+	{
+		return;
+	}
+
+	const auto& BoneContainer{Output.Pose.GetPose().GetBoneContainer()};
+
+	for (const auto& Bone : Bones)
+	{
+		if (!Bone.Bone.IsValidToEvaluate(BoneContainer))
+		{
+			continue;
+		}
+
+		const auto BoneIndex{Bone.Bone.GetCompactPoseIndex(BoneContainer)};
+		const auto WeightAmount{Bone.Weight / TotalWeight};
+
+		// Apply the rotations of the previous bones first, since the output transforms of all bones are set in component space.
+
+		auto BoneTransform{Output.Pose.GetComponentSpaceTransform(BoneIndex) * ChainTransform};
+
+		const auto Rotation{
+			FQuat{UpAxis, FMath::DegreesToRadians(YawAngle * WeightAmount)} *
+			FQuat{RightAxis, FMath::DegreesToRadians(-PitchAngle * WeightAmount)}
+		};
+
+		const auto Pivot{BoneTransform.GetLocation()};
+
+		ChainTransform = ChainTransform * FTransform{-Pivot} * FTransform{Rotation} * FTransform{Pivot};
+
+		BoneTransform.SetRotation(Rotation * BoneTransform.GetRotation());
+
+		OutBoneTransforms.Emplace(BoneIndex, BoneTransform);
+	}
+}
+
+void FAlsAnimNode_SpineRotation::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(Initialize_AnyThread)
+
+	Super::Initialize_AnyThread(Context);
+
+	bReinitializationRequired = true;
+}
+
+void FAlsAnimNode_SpineRotation::UpdateInternal(const FAnimationUpdateContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(UpdateInternal)
+
+	Super::UpdateInternal(Context);
+
+	const auto TargetSpineYawAngle{FMath::Clamp(SpineYawAngle, -MaxSpineYawAngle, MaxSpineYawAngle)};
+	const auto TargetSpinePitchAngle{FMath::Clamp(SpinePitchAngle, -MaxSpinePitchAngle, MaxSpinePitchAngle)};
+	const auto TargetHeadYawAngle{FMath::Clamp(HeadYawAngle, -MaxHeadYawAngle, MaxHeadYawAngle)};
+	const auto TargetHeadPitchAngle{FMath::Clamp(HeadPitchAngle, -MaxHeadPitchAngle, MaxHeadPitchAngle)};
+
+	if (bReinitializationRequired || InterpolationSpeed <= 0.0f)
+	{
+		bReinitializationRequired = false;
+
+		CurrentSpineYawAngle = TargetSpineYawAngle;
+		CurrentSpinePitchAngle = TargetSpinePitchAngle;
+		CurrentHeadYawAngle = TargetHeadYawAngle;
+		CurrentHeadPitchAngle = TargetHeadPitchAngle;
+		return;
+	}
+
+	const auto DeltaTime{Context.GetDeltaTime()};
+
+	CurrentSpineYawAngle = UAlsMath::ExponentialDecay(CurrentSpineYawAngle, TargetSpineYawAngle, DeltaTime, InterpolationSpeed);
+	CurrentSpinePitchAngle = UAlsMath::ExponentialDecay(CurrentSpinePitchAngle, TargetSpinePitchAngle, DeltaTime, InterpolationSpeed);
+	CurrentHeadYawAngle = UAlsMath::ExponentialDecay(CurrentHeadYawAngle, TargetHeadYawAngle, DeltaTime, InterpolationSpeed);
+	CurrentHeadPitchAngle = UAlsMath::ExponentialDecay(CurrentHeadPitchAngle, TargetHeadPitchAngle, DeltaTime, InterpolationSpeed);
+}
+
+void FAlsAnimNode_SpineRotation::GatherDebugData(FNodeDebugData& DebugData)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(GatherDebugData)
+
+	DebugData.AddDebugItem(FString::Printf(TEXT("%s: Spine Yaw: %.2f, Spine Pitch: %.2f, Head Yaw: %.2f, Head Pitch: %.2f."),
+	                                       *DebugData.GetNodeName(this), CurrentSpineYawAngle, CurrentSpinePitchAngle,
+	                                       CurrentHeadYawAngle, CurrentHeadPitchAngle));
+	ComponentPose.GatherDebugData(DebugData);
+}
+
+void FAlsAnimNode_SpineRotation::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output,
+                                                                   TArray<FBoneTransform>& OutBoneTransforms)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(EvaluateSkeletalControl_AnyThread)
+
+	// Rotate bones around the up and right axes of the actor, expressed in component space.
+
+	const auto ComponentRotation{Output.AnimInstanceProxy->GetComponentTransform().GetRotation()};
+	const auto& ActorTransform{Output.AnimInstanceProxy->GetActorTransform()};
+
+	const auto UpAxis{ComponentRotation.UnrotateVector(ActorTransform.GetUnitAxis(EAxis::Z))};
+	const auto RightAxis{ComponentRotation.UnrotateVector(ActorTransform.GetUnitAxis(EAxis::Y))};
+
+	// The head chain continues from the end of the spine chain, so it inherits the spine rotation.
+
+	auto ChainTransform{FTransform::Identity};
+
+	RotateBoneChain(Output, SpineBones, UpAxis, RightAxis, CurrentSpineYawAngle,
+	                CurrentSpinePitchAngle, ChainTransform, OutBoneTransforms);
+
+	RotateBoneChain(Output, HeadBones, UpAxis, RightAxis, CurrentHeadYawAngle,
+	                CurrentHeadPitchAngle, ChainTransform, OutBoneTransforms);
+}
+
+bool FAlsAnimNode_SpineRotation::IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones)
+{
+	for (const auto& Bone : SpineBones)
+	{
+		if (Bone.Bone.IsValidToEvaluate(RequiredBones))
+		{
+			return true;
+		}
+	}
+
+	for (const auto& Bone : HeadBones)
+	{
+		if (Bone.Bone.IsValidToEvaluate(RequiredBones))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FAlsAnimNode_SpineRotation::InitializeBoneReferences(const FBoneContainer& RequiredBones)
+{
+	for (auto& Bone : SpineBones)
+	{
+		Bone.Bone.Initialize(RequiredBones);
+	}
+
+	for (auto& Bone : HeadBones)
+	{
+		Bone.Bone.Initialize(RequiredBones);
+	}
+}
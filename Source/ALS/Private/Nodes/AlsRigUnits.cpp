@@ -1,5 +1,6 @@
 #include "Nodes/AlsRigUnits.h"
 
+#include "TwoBoneIK.h"
 #include "Animation/AnimTypes.h"
 #include "Units/RigUnitContext.h"
 #include "Utility/AlsMath.h"
@@ -34,6 +35,50 @@ static bool TryCalculatePoleVector(const FVector& ALocation, const FVector& BLoc
 	return true;
 }
 
+static float CalculateMaxPelvisOffsetZ(const FVector& ThighLocation, const FVector& CalfLocation,
+                                       const FVector& FootLocation, const FVector& TargetLocation)
+{
+	// Find the highest pelvis offset at which the target is still within reach of the straightened leg.
+
+	const auto LegLength{FVector::Dist(ThighLocation, CalfLocation) + FVector::Dist(CalfLocation, FootLocation)};
+
+	return TargetLocation.Z - ThighLocation.Z +
+	       FMath::Sqrt(FMath::Max(0.0f, FMath::Square(LegLength) - FVector::DistSquared2D(ThighLocation, TargetLocation)));
+}
+
+static void SolveLegIk(URigHierarchy* Hierarchy, const FCachedRigElement& ThighBone, const FCachedRigElement& CalfBone,
+                       const FCachedRigElement& FootBone, const FAlsFootState& FootState, const float Amount)
+{
+	auto ThighTransform{Hierarchy->GetGlobalTransform(ThighBone)};
+	auto CalfTransform{Hierarchy->GetGlobalTransform(CalfBone)};
+	auto FootTransform{Hierarchy->GetGlobalTransform(FootBone)};
+
+	FVector PoleLocation;
+	FVector PoleDirection;
+
+	if (!TryCalculatePoleVector(ThighTransform.GetLocation(), CalfTransform.GetLocation(),
+	                            FootTransform.GetLocation(), PoleLocation, PoleDirection) &&
+	    !TryCalculatePoleVector(Hierarchy->GetInitialGlobalTransform(ThighBone).GetLocation(),
+	                            Hierarchy->GetInitialGlobalTransform(CalfBone).GetLocation(),
+	                            Hierarchy->GetInitialGlobalTransform(FootBone).GetLocation(), PoleLocation, PoleDirection))
+	{
+		return;
+	}
+
+	const auto ThighLength{FVector::Dist(ThighTransform.GetLocation(), CalfTransform.GetLocation())};
+
+	const auto JointTarget{CalfTransform.GetLocation() + PoleDirection * ThighLength};
+	const auto Effector{FMath::Lerp(FootTransform.GetLocation(), FootState.IkLocation, Amount)};
+
+	AnimationCore::SolveTwoBoneIK(ThighTransform, CalfTransform, FootTransform, JointTarget, Effector, false, 1.0f, 1.0f);
+
+	FootTransform.SetRotation(FQuat::Slerp(FootTransform.GetRotation(), FootState.IkRotation, Amount));
+
+	Hierarchy->SetGlobalTransform(ThighBone, ThighTransform, false);
+	Hierarchy->SetGlobalTransform(CalfBone, CalfTransform, false);
+	Hierarchy->SetGlobalTransform(FootBone, FootTransform, true);
+}
+
 FAlsRigUnit_ExponentialDecayVector_Execute()
 {
 	DECLARE_SCOPE_HIERARCHICAL_COUNTER_RIGUNIT()
@@ -159,19 +204,16 @@ FAlsRigUnit_HandIkRetargeting_Execute()
 		return;
 	}
 
+	// Cached elements are only resolved again when their key or the hierarchy topology changes, so
+	// the array is resized only when the number of bones changes, without dropping valid entries.
+
 	if (CachedBonesToMove.Num() != BonesToMove.Num())
 	{
-		CachedBonesToMove.Reset();
-		CachedBonesToMove.SetNum(CachedBonesToMove.Num());
+		CachedBonesToMove.SetNum(BonesToMove.Num());
 	}
 
 	for (auto i{0}; i < BonesToMove.Num(); i++)
 	{
-		if (Context.State == EControlRigState::Init)
-		{
-			CachedBonesToMove[i].Reset();
-		}
-
 		if (!CachedBonesToMove[i].UpdateCache(BonesToMove[i], Hierarchy))
 		{
 			continue;
@@ -183,3 +225,96 @@ FAlsRigUnit_HandIkRetargeting_Execute()
 		Hierarchy->SetGlobalTransform(CachedBonesToMove[i], BoneTransform, bPropagateToChildren);
 	}
 }
+
+FAlsRigUnit_ApplyFeetIk_Execute()
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_RIGUNIT()
+
+	auto* Hierarchy{ExecuteContext.Hierarchy};
+	if (!IsValid(Hierarchy))
+	{
+		return;
+	}
+
+	if (Context.State == EControlRigState::Init)
+	{
+		CachedPelvisBone.Reset();
+		CachedLeftThighBone.Reset();
+		CachedLeftCalfBone.Reset();
+		CachedLeftFootBone.Reset();
+		CachedRightThighBone.Reset();
+		CachedRightCalfBone.Reset();
+		CachedRightFootBone.Reset();
+
+		PelvisOffsetZ = 0.0f;
+		return;
+	}
+
+	if (!CachedPelvisBone.UpdateCache(PelvisBone, Hierarchy) ||
+	    !CachedLeftThighBone.UpdateCache(LeftThighBone, Hierarchy) ||
+	    !CachedLeftCalfBone.UpdateCache(LeftCalfBone, Hierarchy) ||
+	    !CachedLeftFootBone.UpdateCache(LeftFootBone, Hierarchy) ||
+	    !CachedRightThighBone.UpdateCache(RightThighBone, Hierarchy) ||
+	    !CachedRightCalfBone.UpdateCache(RightCalfBone, Hierarchy) ||
+	    !CachedRightFootBone.UpdateCache(RightFootBone, Hierarchy))
+	{
+		return;
+	}
+
+	const auto LeftAmount{FeetState.Left.IkAmount * UAlsMath::Clamp01(Weight)};
+	const auto RightAmount{FeetState.Right.IkAmount * UAlsMath::Clamp01(Weight)};
+
+	// Pelvis
+
+	auto TargetPelvisOffsetZ{0.0f};
+
+	if (FAnimWeight::IsRelevant(LeftAmount) || FAnimWeight::IsRelevant(RightAmount))
+	{
+		const auto LeftFootLocation{Hierarchy->GetGlobalTransform(CachedLeftFootBone).GetLocation()};
+		const auto RightFootLocation{Hierarchy->GetGlobalTransform(CachedRightFootBone).GetLocation()};
+
+		const auto LeftMaxPelvisOffsetZ{
+			CalculateMaxPelvisOffsetZ(Hierarchy->GetGlobalTransform(CachedLeftThighBone).GetLocation(),
+			                          Hierarchy->GetGlobalTransform(CachedLeftCalfBone).GetLocation(), LeftFootLocation,
+			                          FMath::Lerp(LeftFootLocation, FeetState.Left.IkLocation, LeftAmount))
+		};
+
+		const auto RightMaxPelvisOffsetZ{
+			CalculateMaxPelvisOffsetZ(Hierarchy->GetGlobalTransform(CachedRightThighBone).GetLocation(),
+			                          Hierarchy->GetGlobalTransform(CachedRightCalfBone).GetLocation(), RightFootLocation,
+			                          FMath::Lerp(RightFootLocation, FeetState.Right.IkLocation, RightAmount))
+		};
+
+		// Never move the pelvis below the lowest foot offset or above the highest one.
+
+		const auto PelvisAmount{FMath::Max(LeftAmount, RightAmount)};
+
+		TargetPelvisOffsetZ = FMath::Clamp(FMath::Min(LeftMaxPelvisOffsetZ, RightMaxPelvisOffsetZ),
+		                                   FeetState.MinMaxPelvisOffsetZ.X * PelvisAmount,
+		                                   FeetState.MinMaxPelvisOffsetZ.Y * PelvisAmount);
+	}
+
+	PelvisOffsetZ = PelvisOffsetInterpolationSpeed > 0.0f
+		                ? UAlsMath::ExponentialDecay(PelvisOffsetZ, TargetPelvisOffsetZ, Context.DeltaTime, PelvisOffsetInterpolationSpeed)
+		                : TargetPelvisOffsetZ;
+
+	if (!FMath::IsNearlyZero(PelvisOffsetZ))
+	{
+		auto PelvisTransform{Hierarchy->GetGlobalTransform(CachedPelvisBone)};
+		PelvisTransform.AddToTranslation({0.0f, 0.0f, PelvisOffsetZ});
+
+		Hierarchy->SetGlobalTransform(CachedPelvisBone, PelvisTransform, true);
+	}
+
+	// Legs
+
+	if (FAnimWeight::IsRelevant(LeftAmount))
+	{
+		SolveLegIk(Hierarchy, CachedLeftThighBone, CachedLeftCalfBone, CachedLeftFootBone, FeetState.Left, LeftAmount);
+	}
+
+	if (FAnimWeight::IsRelevant(RightAmount))
+	{
+		SolveLegIk(Hierarchy, CachedRightThighBone, CachedRightCalfBone, CachedRightFootBone, FeetState.Right, RightAmount);
+	}
+}
@@ -31,7 +31,8 @@ void UAlsAnimNotifyState_EarlyBlendOut::NotifyTick(USkeletalMeshComponent* Mesh,
 	    ((bCheckInput && Character->GetLocomotionState().bHasInput) ||
 	     (bCheckLocomotionMode && Character->GetLocomotionMode() == LocomotionModeEquals) ||
 	     (bCheckRotationMode && Character->GetRotationMode() == RotationModeEquals) ||
-	     (bCheckStance && Character->GetStance() == StanceEquals)))
+	     (bCheckStance && Character->GetStance() == StanceEquals) ||
+	     (bCheckStateGate && Character->MatchesStateGate(StateGateMatches))))
 	// ReSharper restore CppRedundantParentheses
 	{
 		AnimationInstance->Montage_Stop(BlendOutDuration, Montage);
@@ -0,0 +1,112 @@
+﻿#include "RootMotionSources/AlsRootMotionSource_Rolling.h"
+
+#include "Animation/AnimMontage.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Utility/AlsMacros.h"
+
+FAlsRootMotionSource_Rolling::FAlsRootMotionSource_Rolling()
+{
+	Priority = 1000;
+}
+
+FRootMotionSource* FAlsRootMotionSource_Rolling::Clone() const
+{
+	return new FAlsRootMotionSource_Rolling{*this};
+}
+
+bool FAlsRootMotionSource_Rolling::Matches(const FRootMotionSource* Other) const
+{
+	if (!Super::Matches(Other))
+	{
+		return false;
+	}
+
+	const auto* OtherCasted{static_cast<const FAlsRootMotionSource_Rolling*>(Other)};
+
+	return Montage == OtherCasted->Montage &&
+	       FMath::IsNearlyEqual(PlayRate, OtherCasted->PlayRate) &&
+	       FMath::IsNearlyEqual(StartYawAngle, OtherCasted->StartYawAngle) &&
+	       FMath::IsNearlyEqual(TargetYawAngle, OtherCasted->TargetYawAngle) &&
+	       FMath::IsNearlyEqual(RotationInterpolationSpeed, OtherCasted->RotationInterpolationSpeed);
+}
+
+void FAlsRootMotionSource_Rolling::PrepareRootMotion(const float SimulationDeltaTime, const float DeltaTime,
+                                                     const ACharacter& Character, const UCharacterMovementComponent& Movement)
+{
+	const auto PreviousTime{GetTime()};
+
+	SetTime(GetTime() + SimulationDeltaTime);
+
+	if (!ALS_ENSURE(IsValid(Montage)) || DeltaTime <= SMALL_NUMBER)
+	{
+		RootMotionParams.Clear();
+		return;
+	}
+
+	// The root motion of the montage itself is disabled while rolling, so extract it here
+	// instead. This way it is predicted and replayed along with the rest of the movement.
+
+	const auto MontageRootMotion{Montage->ExtractRootMotionFromTrackRange(PreviousTime * PlayRate, GetTime() * PlayRate)};
+
+	// Use the character rotation instead of the mesh rotation, because the mesh may be affected by network smoothing.
+
+	const auto ActorQuat{Movement.UpdatedComponent->GetComponentQuat()};
+
+	const auto Translation{
+		(ActorQuat * Character.GetBaseRotationOffset()).RotateVector(
+			MontageRootMotion.GetTranslation() * Character.GetMesh()->GetComponentScale())
+	};
+
+	// Calculate the yaw angle as a function of time, so that the result doesn't depend on the frame rate.
+
+	const auto YawAngle{
+		RotationInterpolationSpeed > 0.0f
+			? StartYawAngle + FRotator::NormalizeAxis(TargetYawAngle - StartYawAngle) *
+			  (1.0f - FMath::Exp(-RotationInterpolationSpeed * GetTime()))
+			: TargetYawAngle
+	};
+
+	const FQuat RotationDelta{
+		FVector::UpVector, FMath::DegreesToRadians(FRotator::NormalizeAxis(YawAngle - ActorQuat.Rotator().Yaw))
+	};
+
+	RootMotionParams.Set(FTransform{RotationDelta, Translation} * ScalarRegister{1.0f / DeltaTime});
+	bSimulatedNeedsSmoothing = true;
+}
+
+bool FAlsRootMotionSource_Rolling::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	if (!Super::NetSerialize(Archive, Map, bSuccess))
+	{
+		bSuccess = false;
+		return false;
+	}
+
+	Archive << Montage;
+	Archive << PlayRate;
+	Archive << StartYawAngle;
+	Archive << TargetYawAngle;
+	Archive << RotationInterpolationSpeed;
+
+	bSuccess = true;
+	return true;
+}
+
+UScriptStruct* FAlsRootMotionSource_Rolling::GetScriptStruct() const
+{
+	return StaticStruct();
+}
+
+FString FAlsRootMotionSource_Rolling::ToSimpleString() const
+{
+	return FString::Format(TEXT("{0} ({1}, {2})"), {ALS_GET_TYPE_STRING(FAlsRootMotionSource_Rolling), *InstanceName.ToString(), LocalID});
+}
+
+void FAlsRootMotionSource_Rolling::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(Collector);
+
+	Collector.AddReferencedObject(Montage);
+}
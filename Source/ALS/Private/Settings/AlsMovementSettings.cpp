@@ -0,0 +1,123 @@
+﻿#include "Settings/AlsMovementSettings.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+#include "Utility/AlsLog.h"
+
+float FAlsMovementGaitSettings::CalculateGaitAmount(const float Speed) const
+{
+	// Map the speed to the configured movement speeds ranging from 0 to 3, where 0 is stopped, 1 is walking, 2 is running,
+	// and 3 is sprinting. This allows us to vary movement speeds but still use the mapped range in calculations for consistent results.
+
+	if (Speed <= WalkSpeed)
+	{
+		static const FVector2f GaitAmount{0.0f, 1.0f};
+
+		return FMath::GetMappedRangeValueClamped({0.0f, WalkSpeed}, GaitAmount, Speed);
+	}
+
+	if (Speed <= RunSpeed)
+	{
+		static const FVector2f GaitAmount{1.0f, 2.0f};
+
+		return FMath::GetMappedRangeValueClamped({WalkSpeed, RunSpeed}, GaitAmount, Speed);
+	}
+
+	static const FVector2f GaitAmount{2.0f, 3.0f};
+
+	return FMath::GetMappedRangeValueClamped({RunSpeed, SprintSpeed}, GaitAmount, Speed);
+}
+
+float FAlsMovementGaitSettings::CalculateMaxAcceleration(const float GaitAmount) const
+{
+	return AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].Eval(GaitAmount);
+}
+
+float FAlsMovementGaitSettings::CalculateMaxBrakingDeceleration(const float GaitAmount) const
+{
+	return AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[1].Eval(GaitAmount);
+}
+
+float FAlsMovementGaitSettings::CalculateGroundFriction(const float GaitAmount) const
+{
+	return AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(GaitAmount);
+}
+
+float FAlsMovementGaitSettings::CalculateRotationInterpolationSpeed(const float GaitAmount) const
+{
+	return RotationInterpolationSpeedCurve->FloatCurve.Eval(GaitAmount);
+}
+
+UAlsMovementSettings::UAlsMovementSettings()
+{
+	Initialize();
+}
+
+void UAlsMovementSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	Initialize();
+}
+
+#if WITH_EDITOR
+void UAlsMovementSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Initialize();
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UAlsMovementSettings::Initialize()
+{
+	RotationModeTags = {AlsRotationModeTags::LookingDirection, AlsRotationModeTags::VelocityDirection, AlsRotationModeTags::Aiming};
+	StanceTags = {AlsStanceTags::Standing, AlsStanceTags::Crouching};
+
+	for (const auto& RotationModePair : RotationModes)
+	{
+		if (RotationModePair.Key.IsValid())
+		{
+			RotationModeTags.AddUnique(RotationModePair.Key);
+		}
+
+		for (const auto& StancePair : RotationModePair.Value.Stances)
+		{
+			if (StancePair.Key.IsValid())
+			{
+				StanceTags.AddUnique(StancePair.Key);
+			}
+		}
+	}
+
+	GaitSettings.Reset(RotationModeTags.Num() * StanceTags.Num());
+	GaitSettingsValid.Reset(RotationModeTags.Num() * StanceTags.Num());
+
+	for (const auto& RotationMode : RotationModeTags)
+	{
+		const auto* StanceSettings{RotationModes.Find(RotationMode)};
+
+		for (const auto& Stance : StanceTags)
+		{
+			const auto* StanceGaitSettings{StanceSettings != nullptr ? StanceSettings->Stances.Find(Stance) : nullptr};
+			if (StanceGaitSettings != nullptr)
+			{
+				GaitSettings.Add(*StanceGaitSettings);
+				GaitSettingsValid.Add(true);
+				continue;
+			}
+
+			// Missing combinations still get an entry so that every index stays valid, but it's marked as
+			// invalid so that the lookup fails loudly instead of silently falling back to default settings.
+
+			if (!HasAnyFlags(RF_ClassDefaultObject))
+			{
+				UE_LOG(LogAls, Error, __FUNCTION__ TEXT(": %s has no gait settings for the %s rotation mode and the %s stance."),
+				       *GetPathName(), *RotationMode.ToString(), *Stance.ToString());
+			}
+
+			GaitSettings.AddDefaulted();
+			GaitSettingsValid.Add(false);
+		}
+	}
+}
@@ -0,0 +1,55 @@
+﻿#include "Settings/AlsTransitionsSettings.h"
+
+#include "Utility/AlsGameplayTags.h"
+
+UAnimSequenceBase* FAlsTransitionsSettings::GetTransitionAnimation(const FGameplayTag& Stance, const bool bLeft) const
+{
+	if (Stance == AlsStanceTags::Crouching)
+	{
+		return bLeft ? CrouchingTransitionLeftAnimation : CrouchingTransitionRightAnimation;
+	}
+
+	const auto* Animations{FindAdditionalStanceAnimations(Stance)};
+	if (Animations != nullptr)
+	{
+		return bLeft ? Animations->TransitionLeftAnimation : Animations->TransitionRightAnimation;
+	}
+
+	return bLeft ? StandingTransitionLeftAnimation : StandingTransitionRightAnimation;
+}
+
+UAnimSequenceBase* FAlsTransitionsSettings::GetDynamicTransitionAnimation(const FGameplayTag& Stance, const bool bLeft) const
+{
+	if (Stance == AlsStanceTags::Crouching)
+	{
+		return bLeft ? CrouchingDynamicTransitionLeftAnimation : CrouchingDynamicTransitionRightAnimation;
+	}
+
+	const auto* Animations{FindAdditionalStanceAnimations(Stance)};
+	if (Animations != nullptr)
+	{
+		return bLeft ? Animations->DynamicTransitionLeftAnimation : Animations->DynamicTransitionRightAnimation;
+	}
+
+	return bLeft ? StandingDynamicTransitionLeftAnimation : StandingDynamicTransitionRightAnimation;
+}
+
+const FAlsStanceTransitionAnimations* FAlsTransitionsSettings::FindAdditionalStanceAnimations(const FGameplayTag& Stance) const
+{
+	if (Stance == AlsStanceTags::Standing || Stance == AlsStanceTags::Crouching || !Stance.IsValid())
+	{
+		return nullptr;
+	}
+
+	// There are only a few stances, so a linear search is faster than a map lookup here.
+
+	for (const auto& Animations : AdditionalStanceAnimations)
+	{
+		if (Animations.Stance == Stance)
+		{
+			return &Animations;
+		}
+	}
+
+	return nullptr;
+}
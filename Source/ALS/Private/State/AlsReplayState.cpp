@@ -0,0 +1,34 @@
+﻿#include "State/AlsReplayState.h"
+
+#include "Animation/AnimMontage.h"
+#include "Utility/AlsGameplayTags.h"
+
+bool FAlsReplayState::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+	auto bSuccessLocal{true};
+
+	LocomotionAction.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	// Serialize only the data relevant to the current locomotion action to keep the replay size small.
+
+	if (LocomotionAction.IsValid())
+	{
+		Archive << ActionMontage;
+		Archive << ActionMontagePosition;
+	}
+	else if (Archive.IsLoading())
+	{
+		ActionMontage = nullptr;
+		ActionMontagePosition = 0.0f;
+	}
+
+	if (LocomotionAction == AlsLocomotionActionTags::Ragdolling)
+	{
+		RagdollPelvisLocation.NetSerialize(Archive, Map, bSuccessLocal);
+		bSuccess &= bSuccessLocal;
+	}
+
+	return bSuccess;
+}
@@ -0,0 +1,140 @@
+#include "Misc/AutomationTest.h"
+#include "Utility/AlsMath.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsMathTests
+{
+	static constexpr auto HighFrameRate{120};
+	static constexpr auto LowFrameRate{15};
+
+	// In seconds.
+	static constexpr auto Duration{2};
+
+	// Both frame rates step the target from 100 to -50 at the end of this frame.
+	static constexpr auto TargetStepTime{0.6f};
+
+	float GetStepTarget(const float Time)
+	{
+		return Time <= TargetStepTime + KINDA_SMALL_NUMBER ? 100.0f : -50.0f;
+	}
+
+	float GetRampTarget(const float Time)
+	{
+		return 100.0f * UAlsMath::Clamp01(Time);
+	}
+
+	// Starts the spring at rest at zero, so that both frame rates start from the same state.
+	FAlsSpringFloatState MakeRestingSpringState()
+	{
+		FAlsSpringFloatState SpringState;
+		SpringState.bStateValid = true;
+
+		return SpringState;
+	}
+
+	// Steps the interpolator at the given frame rate, with the target sampled at the end of each frame, and returns the
+	// values at the end of each low frame rate frame, so that the results of both frame rates can be compared directly.
+	template <typename TargetFunctionType, typename InterpolatorType>
+	TArray<float> Simulate(const int32 FrameRate, TargetFunctionType GetTarget, InterpolatorType Interpolate)
+	{
+		const auto FramesPerSample{FrameRate / LowFrameRate};
+		const auto DeltaTime{1.0f / static_cast<float>(FrameRate)};
+
+		TArray<float> Samples;
+		Samples.Reserve(Duration * LowFrameRate);
+
+		auto Value{0.0f};
+
+		for (auto i{1}; i <= FrameRate * Duration; i++)
+		{
+			Value = Interpolate(Value, GetTarget(static_cast<float>(i) * DeltaTime), DeltaTime);
+
+			if (i % FramesPerSample == 0)
+			{
+				Samples.Add(Value);
+			}
+		}
+
+		return Samples;
+	}
+
+	template <typename TargetFunctionType, typename InterpolatorType>
+	void TestFrameRateIndependence(FAutomationTestBase& Test, const TCHAR* Description, TargetFunctionType GetTarget,
+	                               InterpolatorType Interpolate, const float MaxDeviation, const float MaxFinalError)
+	{
+		const auto HighFrameRateSamples{Simulate(HighFrameRate, GetTarget, Interpolate)};
+		const auto LowFrameRateSamples{Simulate(LowFrameRate, GetTarget, Interpolate)};
+
+		if (!Test.TestEqual(FString::Printf(TEXT("%s number of samples"), Description),
+		                    LowFrameRateSamples.Num(), HighFrameRateSamples.Num()))
+		{
+			return;
+		}
+
+		auto Deviation{0.0f};
+		auto DeviationSampleIndex{0};
+
+		for (auto i{0}; i < HighFrameRateSamples.Num(); i++)
+		{
+			const auto SampleDeviation{FMath::Abs(HighFrameRateSamples[i] - LowFrameRateSamples[i])};
+			if (SampleDeviation > Deviation)
+			{
+				Deviation = SampleDeviation;
+				DeviationSampleIndex = i;
+			}
+		}
+
+		Test.TestTrue(FString::Printf(TEXT("%s deviation between %d Hz and %d Hz (%.3f at %.3f s)"), Description, HighFrameRate,
+		                              LowFrameRate, Deviation, static_cast<float>(DeviationSampleIndex + 1) / LowFrameRate),
+		              Deviation <= MaxDeviation);
+
+		const auto FinalTarget{GetTarget(static_cast<float>(Duration))};
+
+		Test.TestEqual(FString::Printf(TEXT("%s final value at %d Hz"), Description, HighFrameRate),
+		               HighFrameRateSamples.Last(), FinalTarget, MaxFinalError);
+		Test.TestEqual(FString::Printf(TEXT("%s final value at %d Hz"), Description, LowFrameRate),
+		               LowFrameRateSamples.Last(), FinalTarget, MaxFinalError);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathFrameRateIndependenceTest, "Als.Utility.Math.FrameRateIndependence",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathFrameRateIndependenceTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	// The exponential decay is evaluated in closed form, so only the error of the exponent approximation remains.
+
+	const auto ExponentialDecay{
+		[](const float Current, const float Target, const float DeltaTime)
+		{
+			return UAlsMath::ExponentialDecay(Current, Target, DeltaTime, 8.0f);
+		}
+	};
+
+	TestFrameRateIndependence(*this, TEXT("Exponential decay"), &GetStepTarget, ExponentialDecay, 0.5f, 0.1f);
+	TestFrameRateIndependence(*this, TEXT("Exponential decay with a moving target"), &GetRampTarget, ExponentialDecay, 0.5f, 0.1f);
+
+	// The spring damper is integrated numerically, so it depends on the substep delta time, which differs between
+	// the frame rates. The deviation must stay small, and both frame rates must settle on the target.
+
+	const auto MakeSpringDamp{
+		[](const float TargetVelocityAmount)
+		{
+			return [TargetVelocityAmount, SpringState{MakeRestingSpringState()}]
+			(const float Current, const float Target, const float DeltaTime) mutable
+			{
+				return UAlsMath::SpringDampFloat(Current, Target, SpringState, DeltaTime, 4.0f, 0.5f, TargetVelocityAmount);
+			};
+		}
+	};
+
+	TestFrameRateIndependence(*this, TEXT("Spring damp"), &GetStepTarget, MakeSpringDamp(0.0f), 15.0f, 0.1f);
+	TestFrameRateIndependence(*this, TEXT("Spring damp with a moving target"), &GetRampTarget, MakeSpringDamp(1.0f), 5.0f, 0.1f);
+
+	return true;
+}
+
+#endif
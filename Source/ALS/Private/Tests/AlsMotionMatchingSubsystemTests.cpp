@@ -0,0 +1,27 @@
+#include "AlsMotionMatchingSubsystem.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMotionMatchingSubsystemSearchBudgetTest, "Als.MotionMatching.SearchBudget",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMotionMatchingSubsystemSearchBudgetTest::RunTest(const FString& Parameters)
+{
+	auto* Subsystem{NewObject<UAlsMotionMatchingSubsystem>(GetTransientPackage())};
+
+	TestTrue(TEXT("First search"), Subsystem->TryStartSearch(2));
+	TestTrue(TEXT("Second search"), Subsystem->TryStartSearch(2));
+	TestFalse(TEXT("Search over the budget"), Subsystem->TryStartSearch(2));
+
+	// Searches over the budget are not counted, so a larger budget of another animation instance still has room.
+
+	TestTrue(TEXT("Search with a larger budget"), Subsystem->TryStartSearch(3));
+	TestFalse(TEXT("Search over the larger budget"), Subsystem->TryStartSearch(3));
+
+	TestTrue(TEXT("Search without a budget"), Subsystem->TryStartSearch(0));
+
+	return true;
+}
+
+#endif
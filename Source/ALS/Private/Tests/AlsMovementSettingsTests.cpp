@@ -0,0 +1,67 @@
+#include "Misc/AutomationTest.h"
+#include "Settings/AlsMovementSettings.h"
+#include "Utility/AlsGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMovementSettingsMissingGaitSettingsTest, "Als.Settings.Movement.MissingGaitSettings",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMovementSettingsMissingGaitSettingsTest::RunTest(const FString& Parameters)
+{
+	auto* Settings{NewObject<UAlsMovementSettings>(GetTransientPackage())};
+
+	for (const auto& RotationMode : Settings->RotationModeTags)
+	{
+		for (const auto& Stance : Settings->StanceTags)
+		{
+			TestNotNull(FString::Printf(TEXT("Default %s %s gait settings"), *RotationMode.ToString(), *Stance.ToString()),
+			            Settings->FindGaitSettings(RotationMode, Stance));
+		}
+	}
+
+	// Any native tag that is not a stance tag stands in for a project-specific stance here. It's configured only for
+	// the looking direction rotation mode, so the other rotation modes miss it, in addition to one removed native entry.
+
+	const auto CustomStance{AlsLocomotionModeTags::Grounded.GetTag()};
+
+	Settings->RotationModes.FindChecked(AlsRotationModeTags::Aiming).Stances.Remove(AlsStanceTags::Crouching);
+
+	auto& CustomStanceSettings{
+		Settings->RotationModes.FindChecked(AlsRotationModeTags::LookingDirection).Stances.Add(CustomStance)
+	};
+
+	CustomStanceSettings.WalkSpeed = 100.0f;
+
+	AddExpectedError(TEXT("has no gait settings"), EAutomationExpectedErrorFlags::Contains, 3);
+
+	Settings->Initialize();
+
+	TestTrue(TEXT("Custom stance"), Settings->StanceTags.Contains(CustomStance));
+	TestEqual(TEXT("Number of gait settings"), Settings->GaitSettings.Num(),
+	          Settings->RotationModeTags.Num() * Settings->StanceTags.Num());
+	TestEqual(TEXT("Number of gait settings validity flags"), Settings->GaitSettingsValid.Num(), Settings->GaitSettings.Num());
+
+	TestNull(TEXT("Removed aiming crouching gait settings"),
+	         Settings->FindGaitSettings(AlsRotationModeTags::Aiming, AlsStanceTags::Crouching));
+	TestNull(TEXT("Missing velocity direction custom stance gait settings"),
+	         Settings->FindGaitSettings(AlsRotationModeTags::VelocityDirection, CustomStance));
+	TestNull(TEXT("Missing aiming custom stance gait settings"),
+	         Settings->FindGaitSettings(AlsRotationModeTags::Aiming, CustomStance));
+
+	TestNotNull(TEXT("Aiming standing gait settings"), Settings->FindGaitSettings(AlsRotationModeTags::Aiming, AlsStanceTags::Standing));
+	TestNull(TEXT("Unknown rotation mode gait settings"), Settings->FindGaitSettings(FGameplayTag::EmptyTag, AlsStanceTags::Standing));
+
+	const auto* LookingDirectionCustomStanceSettings{
+		Settings->FindGaitSettings(AlsRotationModeTags::LookingDirection, CustomStance)
+	};
+
+	if (TestNotNull(TEXT("Looking direction custom stance gait settings"), LookingDirectionCustomStanceSettings))
+	{
+		TestEqual(TEXT("Looking direction custom stance walk speed"), LookingDirectionCustomStanceSettings->WalkSpeed, 100.0f);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,213 @@
+#include "Misc/AutomationTest.h"
+#include "Nodes/AlsRigUnits.h"
+#include "Rigs/RigHierarchy.h"
+#include "Rigs/RigHierarchyController.h"
+#include "Units/RigUnitContext.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsRigUnitsTests
+{
+	// The right hand is 30 cm above its IK bone and the left hand 10 cm above its IK bone, so that the
+	// retargeting offset moves the bones up by 10 cm for the left hand and by 30 cm for the right hand.
+
+	const FVector LeftHandLocation{0.0f, -20.0f, 100.0f};
+	const FVector LeftHandIkLocation{0.0f, -20.0f, 90.0f};
+	const FVector RightHandLocation{0.0f, 20.0f, 100.0f};
+	const FVector RightHandIkLocation{0.0f, 20.0f, 70.0f};
+	const FVector WeaponLocation{30.0f, 0.0f, 100.0f};
+	const FVector MagazineLocation{30.0f, 0.0f, 90.0f};
+
+	const FVector LeftHandOffset{LeftHandLocation - LeftHandIkLocation};
+	const FVector RightHandOffset{RightHandLocation - RightHandIkLocation};
+
+	URigHierarchy* NewHierarchy(const bool bAddSpacerBone = false)
+	{
+		auto* Hierarchy{NewObject<URigHierarchy>(GetTransientPackage())};
+		auto* Controller{Hierarchy->GetController(true)};
+
+		const auto AddBone{
+			[Controller](const TCHAR* Name, const FRigElementKey& Parent, const FVector& Location)
+			{
+				return Controller->AddBone(Name, Parent, FTransform{Location}, true, ERigBoneType::User, false);
+			}
+		};
+
+		const auto RootBone{AddBone(TEXT("root"), FRigElementKey{}, FVector::ZeroVector)};
+
+		if (bAddSpacerBone)
+		{
+			AddBone(TEXT("spacer"), RootBone, FVector::ZeroVector);
+		}
+
+		AddBone(TEXT("hand_l"), RootBone, LeftHandLocation);
+		AddBone(TEXT("ik_hand_l"), RootBone, LeftHandIkLocation);
+		AddBone(TEXT("hand_r"), RootBone, RightHandLocation);
+		AddBone(TEXT("ik_hand_r"), RootBone, RightHandIkLocation);
+		AddBone(TEXT("weapon"), RootBone, WeaponLocation);
+		AddBone(TEXT("magazine"), RootBone, MagazineLocation);
+
+		return Hierarchy;
+	}
+
+	FRigElementKey MakeBoneKey(const TCHAR* Name)
+	{
+		return FRigElementKey{Name, ERigElementType::Bone};
+	}
+
+	FAlsRigUnit_HandIkRetargeting MakeUnit(URigHierarchy* Hierarchy)
+	{
+		FAlsRigUnit_HandIkRetargeting Unit;
+		Unit.ExecuteContext.Hierarchy = Hierarchy;
+		Unit.LeftHandBone = MakeBoneKey(TEXT("hand_l"));
+		Unit.LeftHandIkBone = MakeBoneKey(TEXT("ik_hand_l"));
+		Unit.RightHandBone = MakeBoneKey(TEXT("hand_r"));
+		Unit.RightHandIkBone = MakeBoneKey(TEXT("ik_hand_r"));
+		Unit.BonesToMove = {MakeBoneKey(TEXT("weapon"))};
+
+		FRigUnitContext Context;
+		Context.State = EControlRigState::Init;
+
+		Unit.Execute(Context);
+
+		return Unit;
+	}
+
+	// Executes the unit on the initial pose, so that offsets from previous executions don't accumulate.
+	void Execute(FAlsRigUnit_HandIkRetargeting& Unit)
+	{
+		Unit.ExecuteContext.Hierarchy->ResetPoseToInitial(ERigElementType::Bone);
+
+		FRigUnitContext Context;
+		Context.State = EControlRigState::Update;
+
+		Unit.Execute(Context);
+	}
+
+	FVector GetBoneLocation(const URigHierarchy* Hierarchy, const TCHAR* Name)
+	{
+		return Hierarchy->GetGlobalTransform(MakeBoneKey(Name)).GetLocation();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsRigUnitsHandIkRetargetingWeightTest, "Als.RigUnits.HandIkRetargeting.Weight",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsRigUnitsHandIkRetargetingWeightTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsRigUnitsTests;
+
+	auto* Hierarchy{NewHierarchy()};
+	auto Unit{MakeUnit(Hierarchy)};
+
+	const auto TestWeights{
+		[this, Hierarchy, &Unit](const float RetargetingWeight, const float Weight, const FVector& ExpectedOffset)
+		{
+			Unit.RetargetingWeight = RetargetingWeight;
+			Unit.Weight = Weight;
+
+			Execute(Unit);
+
+			const auto Description{FString::Printf(TEXT("retargeting weight %.2f, weight %.2f"), RetargetingWeight, Weight)};
+
+			TestEqual(FString::Printf(TEXT("Weapon location (%s)"), *Description),
+			          GetBoneLocation(Hierarchy, TEXT("weapon")), WeaponLocation + ExpectedOffset);
+
+			// Bones that are not in the list must not be moved.
+
+			TestEqual(FString::Printf(TEXT("Magazine location (%s)"), *Description),
+			          GetBoneLocation(Hierarchy, TEXT("magazine")), MagazineLocation);
+			TestEqual(FString::Printf(TEXT("Left hand location (%s)"), *Description),
+			          GetBoneLocation(Hierarchy, TEXT("hand_l")), LeftHandLocation);
+			TestEqual(FString::Printf(TEXT("Right hand location (%s)"), *Description),
+			          GetBoneLocation(Hierarchy, TEXT("hand_r")), RightHandLocation);
+		}
+	};
+
+	TestWeights(0.0f, 1.0f, LeftHandOffset);
+	TestWeights(1.0f, 1.0f, RightHandOffset);
+	TestWeights(0.5f, 1.0f, (LeftHandOffset + RightHandOffset) * 0.5f);
+	TestWeights(0.25f, 1.0f, FMath::Lerp(LeftHandOffset, RightHandOffset, 0.25f));
+	TestWeights(1.0f, 0.5f, RightHandOffset * 0.5f);
+	TestWeights(0.0f, 0.5f, LeftHandOffset * 0.5f);
+	TestWeights(0.5f, 0.0f, FVector::ZeroVector);
+
+	// The weight is clamped to 1.
+
+	TestWeights(1.0f, 2.0f, RightHandOffset);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsRigUnitsHandIkRetargetingHierarchyChangesTest, "Als.RigUnits.HandIkRetargeting.HierarchyChanges",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsRigUnitsHandIkRetargetingHierarchyChangesTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsRigUnitsTests;
+
+	// The spacer bone precedes all other bones, so removing it changes the indices of all of them.
+
+	auto* Hierarchy{NewHierarchy(true)};
+	auto Unit{MakeUnit(Hierarchy)};
+	Unit.RetargetingWeight = 1.0f;
+
+	const auto TestBoneLocations{
+		[this, Hierarchy](const TCHAR* Description, const FVector& ExpectedWeaponLocation, const FVector& ExpectedMagazineLocation)
+		{
+			TestEqual(FString::Printf(TEXT("Weapon location (%s)"), Description),
+			          GetBoneLocation(Hierarchy, TEXT("weapon")), ExpectedWeaponLocation);
+			TestEqual(FString::Printf(TEXT("Magazine location (%s)"), Description),
+			          GetBoneLocation(Hierarchy, TEXT("magazine")), ExpectedMagazineLocation);
+			TestEqual(FString::Printf(TEXT("Right hand location (%s)"), Description),
+			          GetBoneLocation(Hierarchy, TEXT("hand_r")), RightHandLocation);
+		}
+	};
+
+	Execute(Unit);
+	TestBoneLocations(TEXT("initial hierarchy"), WeaponLocation + RightHandOffset, MagazineLocation);
+
+	// Executing again with the same cached bones gives the same result.
+
+	Execute(Unit);
+	TestBoneLocations(TEXT("second execution"), WeaponLocation + RightHandOffset, MagazineLocation);
+
+	// Adding a bone to move grows the cached bones.
+
+	Unit.BonesToMove.Add(MakeBoneKey(TEXT("magazine")));
+
+	Execute(Unit);
+	TestBoneLocations(TEXT("added bone to move"), WeaponLocation + RightHandOffset, MagazineLocation + RightHandOffset);
+
+	// A topology change resolves the cached bones again.
+
+	Hierarchy->GetController(true)->RemoveElement(MakeBoneKey(TEXT("spacer")));
+
+	Execute(Unit);
+	TestBoneLocations(TEXT("removed spacer bone"), WeaponLocation + RightHandOffset, MagazineLocation + RightHandOffset);
+
+	// Changing a key resolves its cached bone again.
+
+	Unit.BonesToMove = {MakeBoneKey(TEXT("magazine"))};
+
+	Execute(Unit);
+	TestBoneLocations(TEXT("changed bone to move"), WeaponLocation, MagazineLocation + RightHandOffset);
+
+	// Missing bones are skipped without affecting the other bones.
+
+	Unit.BonesToMove = {MakeBoneKey(TEXT("missing")), MakeBoneKey(TEXT("weapon"))};
+
+	Execute(Unit);
+	TestBoneLocations(TEXT("missing bone to move"), WeaponLocation + RightHandOffset, MagazineLocation);
+
+	// Removing a hand bone disables the unit.
+
+	Hierarchy->GetController(true)->RemoveElement(MakeBoneKey(TEXT("ik_hand_r")));
+
+	Execute(Unit);
+	TestBoneLocations(TEXT("removed right hand IK bone"), WeaponLocation, MagazineLocation);
+
+	return true;
+}
+
+#endif
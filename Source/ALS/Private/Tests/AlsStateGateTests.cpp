@@ -0,0 +1,153 @@
+#include "Misc/AutomationTest.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsStateGate.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsStateGateTests
+{
+	struct FQueryCase
+	{
+		const TCHAR* Name;
+
+		FGameplayTagQuery Query;
+	};
+
+	FGameplayTagContainer MakeContainer(const TArray<FGameplayTag>& Tags)
+	{
+		FGameplayTagContainer Container;
+
+		for (const auto& Tag : Tags)
+		{
+			Container.AddTag(Tag);
+		}
+
+		return Container;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsStateGateQueryEquivalenceTest, "Als.Utility.StateGate.QueryEquivalence",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsStateGateQueryEquivalenceTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsStateGateTests;
+
+	// Parent tags are registered implicitly together with their native child tags. The grounded entry mode tag is not
+	// one of the state tags, so it can't be represented by the state word, same as the parent tags used as state tags.
+
+	const auto StanceTag{FGameplayTag::RequestGameplayTag(TEXT("Als.Stance"))};
+	const auto GaitTag{FGameplayTag::RequestGameplayTag(TEXT("Als.Gait"))};
+	const auto LocomotionActionTag{FGameplayTag::RequestGameplayTag(TEXT("Als.LocomotionAction"))};
+	const auto NonNativeTag{AlsGroundedEntryModeTags::FromRoll.GetTag()};
+
+	const TArray<TArray<FGameplayTag>> States
+	{
+		{},
+		{
+			AlsViewModeTags::ThirdPerson, AlsLocomotionModeTags::Grounded, AlsRotationModeTags::LookingDirection,
+			AlsStanceTags::Standing, AlsGaitTags::Running, AlsOverlayModeTags::Default, FGameplayTag::EmptyTag
+		},
+		{
+			AlsViewModeTags::FirstPerson, AlsLocomotionModeTags::InAir, AlsRotationModeTags::Aiming,
+			AlsStanceTags::Crouching, AlsGaitTags::Walking, AlsOverlayModeTags::M4, AlsLocomotionActionTags::Rolling
+		},
+		{
+			AlsViewModeTags::ThirdPerson, AlsLocomotionModeTags::Grounded, AlsRotationModeTags::VelocityDirection,
+			AlsStanceTags::Crouching, AlsGaitTags::Sprinting, AlsOverlayModeTags::Bow, AlsLocomotionActionTags::Mantling
+		},
+		{
+			AlsViewModeTags::ThirdPerson, AlsLocomotionModeTags::Grounded, AlsRotationModeTags::Aiming,
+			AlsStanceTags::Standing, AlsGaitTags::Walking, AlsOverlayModeTags::Barrel, NonNativeTag
+		},
+		{
+			AlsViewModeTags::FirstPerson, AlsLocomotionModeTags::Grounded, AlsRotationModeTags::LookingDirection,
+			StanceTag, AlsGaitTags::Running, AlsOverlayModeTags::Default, AlsLocomotionActionTags::Ragdolling
+		}
+	};
+
+	FGameplayTagQueryExpression GroundedExpression;
+	GroundedExpression.AnyTagsMatch().AddTag(AlsLocomotionModeTags::Grounded);
+
+	FGameplayTagQueryExpression NoActionsExpression;
+	NoActionsExpression.AnyTagsMatch().AddTag(AlsLocomotionActionTags::Rolling).AddTag(AlsLocomotionActionTags::Ragdolling);
+
+	FGameplayTagQueryExpression NotRollingOrRagdollingExpression;
+	NotRollingOrRagdollingExpression.NoExprMatch().AddExpr(NoActionsExpression);
+
+	FGameplayTagQueryExpression AimingCrouchedExpression;
+	AimingCrouchedExpression.AllTagsMatch().AddTag(AlsRotationModeTags::Aiming).AddTag(AlsStanceTags::Crouching);
+
+	FGameplayTagQueryExpression NotFirstPersonExpression;
+	NotFirstPersonExpression.NoTagsMatch().AddTag(AlsViewModeTags::FirstPerson);
+
+	FGameplayTagQueryExpression AimingCrouchedOrThirdPersonExpression;
+	AimingCrouchedOrThirdPersonExpression.AnyExprMatch().AddExpr(AimingCrouchedExpression).AddExpr(NotFirstPersonExpression);
+
+	FGameplayTagQueryExpression RootExpression;
+	RootExpression.AllExprMatch().AddExpr(GroundedExpression).AddExpr(NotRollingOrRagdollingExpression)
+	              .AddExpr(AimingCrouchedOrThirdPersonExpression);
+
+	FGameplayTagQueryExpression EmptyAnyExpression;
+	EmptyAnyExpression.AnyExprMatch();
+
+	FGameplayTagQueryExpression EmptyAllExpression;
+	EmptyAllExpression.AllExprMatch();
+
+	const TArray<FQueryCase> Queries
+	{
+		{TEXT("Empty"), FGameplayTagQuery::EmptyQuery},
+		{
+			TEXT("Any tags"),
+			FGameplayTagQuery::MakeQuery_MatchAnyTags(MakeContainer({AlsLocomotionModeTags::InAir, AlsStanceTags::Crouching}))
+		},
+		{
+			TEXT("All tags"),
+			FGameplayTagQuery::MakeQuery_MatchAllTags(MakeContainer({AlsLocomotionModeTags::Grounded, AlsStanceTags::Crouching}))
+		},
+		{
+			TEXT("No tags"),
+			FGameplayTagQuery::MakeQuery_MatchNoTags(MakeContainer({AlsLocomotionActionTags::Rolling, AlsLocomotionActionTags::Mantling}))
+		},
+		{TEXT("Any parent tag"), FGameplayTagQuery::MakeQuery_MatchAnyTags(MakeContainer({LocomotionActionTag}))},
+		{TEXT("All parent tags"), FGameplayTagQuery::MakeQuery_MatchAllTags(MakeContainer({StanceTag, GaitTag}))},
+		{TEXT("No parent tags"), FGameplayTagQuery::MakeQuery_MatchNoTags(MakeContainer({LocomotionActionTag}))},
+		{TEXT("Non-native tag"), FGameplayTagQuery::MakeQuery_MatchAnyTags(MakeContainer({NonNativeTag}))},
+		{TEXT("Expression"), FGameplayTagQuery::BuildQuery(RootExpression)},
+		{TEXT("Empty any expression"), FGameplayTagQuery::BuildQuery(EmptyAnyExpression)},
+		{TEXT("Empty all expression"), FGameplayTagQuery::BuildQuery(EmptyAllExpression)}
+	};
+
+	for (const auto& QueryCase : Queries)
+	{
+		const FAlsStateGate Gate{QueryCase.Query};
+
+		for (auto i{0}; i < States.Num(); i++)
+		{
+			const auto Expected{QueryCase.Query.Matches(MakeContainer(States[i]))};
+
+			TestEqual(FString::Printf(TEXT("%s query, state %d"), QueryCase.Name, i), Gate.Matches(States[i]), Expected);
+
+			uint32 StateWord;
+			if (FAlsStateGate::TryMakeStateWord(States[i], StateWord))
+			{
+				TestEqual(FString::Printf(TEXT("%s query, state word %d"), QueryCase.Name, i), Gate.Matches(StateWord), Expected);
+			}
+		}
+	}
+
+	// Changing the query recompiles the gate.
+
+	FAlsStateGate Gate;
+	TestFalse(TEXT("Default gate"), Gate.Matches(States[1]));
+
+	Gate.SetQuery(FGameplayTagQuery::MakeQuery_MatchAnyTags(MakeContainer({AlsStanceTags::Standing})));
+	TestTrue(TEXT("Gate after setting a query"), Gate.Matches(States[1]));
+
+	Gate.SetQuery(FGameplayTagQuery::MakeQuery_MatchNoTags(MakeContainer({AlsStanceTags::Standing})));
+	TestFalse(TEXT("Gate after changing the query"), Gate.Matches(States[1]));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,129 @@
+#include "Animation/AnimSequence.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/AlsTransitionsSettings.h"
+#include "Utility/AlsGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsTransitionsSettingsTests
+{
+	// The selection used before the per-stance lookups were added: crouching animations for the
+	// crouching stance, and standing animations for every other stance, including an invalid one.
+
+	UAnimSequenceBase* GetLegacyTransitionAnimation(const FAlsTransitionsSettings& Settings, const FGameplayTag& Stance,
+	                                                const bool bLeft)
+	{
+		if (Stance == AlsStanceTags::Crouching)
+		{
+			return bLeft ? Settings.CrouchingTransitionLeftAnimation : Settings.CrouchingTransitionRightAnimation;
+		}
+
+		return bLeft ? Settings.StandingTransitionLeftAnimation : Settings.StandingTransitionRightAnimation;
+	}
+
+	UAnimSequenceBase* GetLegacyDynamicTransitionAnimation(const FAlsTransitionsSettings& Settings, const FGameplayTag& Stance,
+	                                                       const bool bLeft)
+	{
+		if (Stance == AlsStanceTags::Crouching)
+		{
+			return bLeft ? Settings.CrouchingDynamicTransitionLeftAnimation : Settings.CrouchingDynamicTransitionRightAnimation;
+		}
+
+		return bLeft ? Settings.StandingDynamicTransitionLeftAnimation : Settings.StandingDynamicTransitionRightAnimation;
+	}
+
+	UAnimSequenceBase* NewAnimation()
+	{
+		return NewObject<UAnimSequence>(GetTransientPackage());
+	}
+
+	FAlsStanceTransitionAnimations NewStanceAnimations(const FGameplayTag& Stance)
+	{
+		FAlsStanceTransitionAnimations Animations;
+		Animations.Stance = Stance;
+		Animations.TransitionLeftAnimation = NewAnimation();
+		Animations.TransitionRightAnimation = NewAnimation();
+		Animations.DynamicTransitionLeftAnimation = NewAnimation();
+		Animations.DynamicTransitionRightAnimation = NewAnimation();
+
+		return Animations;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsTransitionsSettingsSelectionTest, "Als.Settings.Transitions.Selection",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsTransitionsSettingsSelectionTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsTransitionsSettingsTests;
+
+	FAlsTransitionsSettings Settings;
+	Settings.StandingTransitionLeftAnimation = NewAnimation();
+	Settings.StandingTransitionRightAnimation = NewAnimation();
+	Settings.CrouchingTransitionLeftAnimation = NewAnimation();
+	Settings.CrouchingTransitionRightAnimation = NewAnimation();
+	Settings.StandingDynamicTransitionLeftAnimation = NewAnimation();
+	Settings.StandingDynamicTransitionRightAnimation = NewAnimation();
+	Settings.CrouchingDynamicTransitionLeftAnimation = NewAnimation();
+	Settings.CrouchingDynamicTransitionRightAnimation = NewAnimation();
+
+	// Any native tag that is not a stance tag stands in for a project-specific stance here.
+
+	const auto CustomStance{AlsLocomotionModeTags::Grounded.GetTag()};
+
+	const auto TestLegacySelection{
+		[this, &Settings](const FGameplayTag& Stance, const TCHAR* Description)
+		{
+			for (const auto bLeft : {true, false})
+			{
+				TestEqual(FString::Printf(TEXT("%s transition (left: %d)"), Description, bLeft),
+				          Settings.GetTransitionAnimation(Stance, bLeft), GetLegacyTransitionAnimation(Settings, Stance, bLeft));
+
+				TestEqual(FString::Printf(TEXT("%s dynamic transition (left: %d)"), Description, bLeft),
+				          Settings.GetDynamicTransitionAnimation(Stance, bLeft),
+				          GetLegacyDynamicTransitionAnimation(Settings, Stance, bLeft));
+			}
+		}
+	};
+
+	// Without additional stance animations, the selection must be identical to the legacy one.
+
+	TestLegacySelection(AlsStanceTags::Standing, TEXT("Standing"));
+	TestLegacySelection(AlsStanceTags::Crouching, TEXT("Crouching"));
+	TestLegacySelection(FGameplayTag::EmptyTag, TEXT("Invalid stance"));
+	TestLegacySelection(CustomStance, TEXT("Custom stance without animations"));
+
+	// Additional entries for the standing or crouching stance are ignored.
+
+	Settings.AdditionalStanceAnimations.Add(NewStanceAnimations(AlsStanceTags::Standing));
+	Settings.AdditionalStanceAnimations.Add(NewStanceAnimations(AlsStanceTags::Crouching));
+
+	TestLegacySelection(AlsStanceTags::Standing, TEXT("Standing with an additional entry"));
+	TestLegacySelection(AlsStanceTags::Crouching, TEXT("Crouching with an additional entry"));
+	TestLegacySelection(CustomStance, TEXT("Custom stance without its own entry"));
+
+	// Custom stances use their own entry.
+
+	const auto& CustomAnimations{Settings.AdditionalStanceAnimations.Add_GetRef(NewStanceAnimations(CustomStance))};
+
+	TestEqual(TEXT("Custom stance left transition"),
+	          Settings.GetTransitionAnimation(CustomStance, true), CustomAnimations.TransitionLeftAnimation.Get());
+	TestEqual(TEXT("Custom stance right transition"),
+	          Settings.GetTransitionAnimation(CustomStance, false), CustomAnimations.TransitionRightAnimation.Get());
+	TestEqual(TEXT("Custom stance left dynamic transition"),
+	          Settings.GetDynamicTransitionAnimation(CustomStance, true), CustomAnimations.DynamicTransitionLeftAnimation.Get());
+	TestEqual(TEXT("Custom stance right dynamic transition"),
+	          Settings.GetDynamicTransitionAnimation(CustomStance, false), CustomAnimations.DynamicTransitionRightAnimation.Get());
+
+	// Runtime changes to the standing and crouching fields are picked up immediately.
+
+	Settings.StandingTransitionLeftAnimation = NewAnimation();
+	Settings.CrouchingDynamicTransitionRightAnimation = NewAnimation();
+
+	TestLegacySelection(AlsStanceTags::Standing, TEXT("Standing after a runtime change"));
+	TestLegacySelection(AlsStanceTags::Crouching, TEXT("Crouching after a runtime change"));
+
+	return true;
+}
+
+#endif
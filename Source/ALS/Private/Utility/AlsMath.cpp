@@ -18,10 +18,17 @@ ValueType UAlsMath::SpringDamp(const ValueType& Current, const ValueType& Target
 		return Target;
 	}
 
+	const auto TargetVelocity{(Target - SpringState.PreviousTarget) * (Clamp01(TargetVelocityAmount) / DeltaTime)};
+
+	const auto SubstepsCount{FMath::Clamp(FMath::CeilToInt(DeltaTime / SpringDampMaxSubstepDeltaTime), 1, SpringDampMaxSubstepsCount)};
+	const auto SubstepDeltaTime{DeltaTime / static_cast<float>(SubstepsCount)};
+
 	ValueType Result{Current};
-	FMath::SpringDamper(Result, SpringState.Velocity, Target,
-	                    (Target - SpringState.PreviousTarget) * (Clamp01(TargetVelocityAmount) / DeltaTime),
-	                    DeltaTime, Frequency, DampingRatio);
+
+	for (auto i{0}; i < SubstepsCount; i++)
+	{
+		FMath::SpringDamper(Result, SpringState.Velocity, Target, TargetVelocity, SubstepDeltaTime, Frequency, DampingRatio);
+	}
 
 	SpringState.PreviousTarget = Target;
 
@@ -0,0 +1,267 @@
+#include "Utility/AlsStateGate.h"
+
+#include "Utility/AlsGameplayTags.h"
+
+static const TArray<FGameplayTag>& GetNativeStateTags()
+{
+	// Each tag corresponds to a bit of the state word, so there must be no more than 32 of them.
+
+	static const TArray<FGameplayTag> Tags
+	{
+		AlsViewModeTags::FirstPerson,
+		AlsViewModeTags::ThirdPerson,
+
+		AlsLocomotionModeTags::Grounded,
+		AlsLocomotionModeTags::InAir,
+
+		AlsRotationModeTags::LookingDirection,
+		AlsRotationModeTags::VelocityDirection,
+		AlsRotationModeTags::Aiming,
+
+		AlsStanceTags::Standing,
+		AlsStanceTags::Crouching,
+
+		AlsGaitTags::Walking,
+		AlsGaitTags::Running,
+		AlsGaitTags::Sprinting,
+
+		AlsOverlayModeTags::Default,
+		AlsOverlayModeTags::Masculine,
+		AlsOverlayModeTags::Feminine,
+		AlsOverlayModeTags::Injured,
+		AlsOverlayModeTags::HandsTied,
+		AlsOverlayModeTags::M4,
+		AlsOverlayModeTags::PistolOneHanded,
+		AlsOverlayModeTags::PistolTwoHanded,
+		AlsOverlayModeTags::Bow,
+		AlsOverlayModeTags::Torch,
+		AlsOverlayModeTags::Binoculars,
+		AlsOverlayModeTags::Box,
+		AlsOverlayModeTags::Barrel,
+
+		AlsLocomotionActionTags::Rolling,
+		AlsLocomotionActionTags::Mantling,
+		AlsLocomotionActionTags::Ragdolling,
+		AlsLocomotionActionTags::GettingUp
+	};
+
+	check(Tags.Num() <= 32)
+
+	return Tags;
+}
+
+FAlsStateGate::FAlsStateGate(const FGameplayTagQuery& NewQuery)
+{
+	SetQuery(NewQuery);
+}
+
+void FAlsStateGate::PostSerialize(const FArchive& Archive)
+{
+	if (Archive.IsLoading())
+	{
+		Compile();
+	}
+}
+
+void FAlsStateGate::SetQuery(const FGameplayTagQuery& NewQuery)
+{
+	Query = NewQuery;
+
+	Compile();
+}
+
+bool FAlsStateGate::TryMakeStateWord(const TConstArrayView<FGameplayTag> StateTags, uint32& StateWord)
+{
+	const auto& NativeTags{GetNativeStateTags()};
+
+	StateWord = 0;
+
+	for (const auto& Tag : StateTags)
+	{
+		if (!Tag.IsValid())
+		{
+			continue;
+		}
+
+		const auto Index{NativeTags.IndexOfByKey(Tag)};
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+
+		StateWord |= 1u << Index;
+	}
+
+	return true;
+}
+
+bool FAlsStateGate::Matches(const TConstArrayView<FGameplayTag> StateTags) const
+{
+	uint32 StateWord;
+	if (IsCompiled() && TryMakeStateWord(StateTags, StateWord))
+	{
+		return Matches(StateWord);
+	}
+
+	FGameplayTagContainer Tags;
+
+	for (const auto& Tag : StateTags)
+	{
+		Tags.AddTag(Tag);
+	}
+
+	return Query.Matches(Tags);
+}
+
+bool FAlsStateGate::Matches(const uint32 StateWord) const
+{
+	if (IsCompiled())
+	{
+		return Operations.Num() > 0 && EvaluateOperation(0, StateWord);
+	}
+
+	// The operations are outdated, so evaluate the query over the native tags represented by the state word.
+
+	const auto& NativeTags{GetNativeStateTags()};
+
+	FGameplayTagContainer Tags;
+
+	for (auto i{0}; i < NativeTags.Num(); i++)
+	{
+		if ((StateWord & 1u << i) != 0)
+		{
+			Tags.AddTag(NativeTags[i]);
+		}
+	}
+
+	return Query.Matches(Tags);
+}
+
+void FAlsStateGate::Compile()
+{
+	Operations.Reset();
+	Masks.Reset();
+
+	if (!Query.IsEmpty())
+	{
+		FGameplayTagQueryExpression Expression;
+		Query.GetQueryExpr(Expression);
+
+		CompileExpression(Expression);
+	}
+
+#if WITH_EDITORONLY_DATA
+	CompiledQuery = Query;
+#endif
+}
+
+void FAlsStateGate::CompileExpression(const FGameplayTagQueryExpression& Expression)
+{
+	const auto OperationIndex{Operations.Num()};
+
+	Operations.AddDefaulted_GetRef().Type = Expression.ExprType;
+
+	if (Expression.UsesTagSet())
+	{
+		const auto& NativeTags{GetNativeStateTags()};
+
+		Operations[OperationIndex].FirstMaskIndex = Masks.Num();
+		Operations[OperationIndex].NumMasks = Expression.TagSet.Num();
+
+		for (const auto& Tag : Expression.TagSet)
+		{
+			// A state tag matches a query tag if it is the same tag or one of its children, just like in gameplay tag containers.
+
+			uint32 Mask{0};
+
+			for (auto i{0}; i < NativeTags.Num(); i++)
+			{
+				if (NativeTags[i].MatchesTag(Tag))
+				{
+					Mask |= 1u << i;
+				}
+			}
+
+			Masks.Add(Mask);
+		}
+	}
+	else
+	{
+		for (const auto& ChildExpression : Expression.ExprSet)
+		{
+			CompileExpression(ChildExpression);
+		}
+	}
+
+	Operations[OperationIndex].SubtreeSize = Operations.Num() - OperationIndex;
+}
+
+bool FAlsStateGate::IsCompiled() const
+{
+#if WITH_EDITORONLY_DATA
+	return CompiledQuery == Query;
+#else
+	return true;
+#endif
+}
+
+bool FAlsStateGate::EvaluateOperation(const int32 OperationIndex, const uint32 StateWord) const
+{
+	const auto& Operation{Operations[OperationIndex]};
+
+	switch (Operation.Type)
+	{
+		case EGameplayTagQueryExprType::AnyTagsMatch:
+			for (auto i{Operation.FirstMaskIndex}; i < Operation.FirstMaskIndex + Operation.NumMasks; i++)
+			{
+				if ((StateWord & Masks[i]) != 0)
+				{
+					return true;
+				}
+			}
+			return false;
+
+		case EGameplayTagQueryExprType::AllTagsMatch:
+			for (auto i{Operation.FirstMaskIndex}; i < Operation.FirstMaskIndex + Operation.NumMasks; i++)
+			{
+				if ((StateWord & Masks[i]) == 0)
+				{
+					return false;
+				}
+			}
+			return true;
+
+		case EGameplayTagQueryExprType::NoTagsMatch:
+			for (auto i{Operation.FirstMaskIndex}; i < Operation.FirstMaskIndex + Operation.NumMasks; i++)
+			{
+				if ((StateWord & Masks[i]) != 0)
+				{
+					return false;
+				}
+			}
+			return true;
+
+		case EGameplayTagQueryExprType::AnyExprMatch:
+		case EGameplayTagQueryExprType::AllExprMatch:
+		case EGameplayTagQueryExprType::NoExprMatch:
+		{
+			// Stop at the first child whose result decides the result of the whole expression.
+
+			const auto bMatchResult{Operation.Type != EGameplayTagQueryExprType::AllExprMatch};
+			const auto EndIndex{OperationIndex + Operation.SubtreeSize};
+
+			for (auto ChildIndex{OperationIndex + 1}; ChildIndex < EndIndex; ChildIndex += Operations[ChildIndex].SubtreeSize)
+			{
+				if (EvaluateOperation(ChildIndex, StateWord) == bMatchResult)
+				{
+					return Operation.Type == EGameplayTagQueryExprType::AnyExprMatch;
+				}
+			}
+
+			return Operation.Type != EGameplayTagQueryExprType::AnyExprMatch;
+		}
+
+		default:
+			return false;
+	}
+}
@@ -2,22 +2,28 @@
 
 #include "GameplayTagContainer.h"
 #include "Animation/AnimInstance.h"
+#include "State/AlsFarLodState.h"
 #include "State/AlsFeetState.h"
 #include "State/AlsGroundedState.h"
 #include "State/AlsInAirState.h"
 #include "State/AlsLayeringState.h"
 #include "State/AlsLeanState.h"
+#include "State/AlsLinkedAnimationState.h"
 #include "State/AlsLocomotionAnimationState.h"
+#include "State/AlsLodState.h"
+#include "State/AlsMotionMatchingState.h"
 #include "State/AlsPoseState.h"
 #include "State/AlsRagdollingAnimationState.h"
 #include "State/AlsRotateInPlaceState.h"
 #include "State/AlsTransitionsState.h"
 #include "State/AlsTurnInPlaceState.h"
 #include "State/AlsViewAnimationState.h"
+#include "Utility/AlsConstants.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsAnimationInstance.generated.h"
 
 class UAlsAnimationInstanceSettings;
+class UAlsMotionMatchingSubsystem;
 class AAlsCharacter;
 
 UCLASS()
@@ -32,6 +38,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TObjectPtr<AAlsCharacter> Character;
 
+	UPROPERTY(Transient)
+	TObjectPtr<UAlsMotionMatchingSubsystem> MotionMatchingSubsystem;
+
 	// Used to indicate that the animation instance has not been updated for a long time
 	// and its current state may not be correct (such as foot location used in foot locking).
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
@@ -46,6 +55,11 @@ protected:
 
 	TArray<TFunction<void()>> DisplayDebugTracesQueue;
 #endif
+
+	// Layering attribute values fetched from the skeletal mesh in the game thread, indexed by EAlsLayeringCurve.
+	// Used only if layering attributes are used instead of layering curves in the settings.
+	float LayeringAttributes[static_cast<uint8>(EAlsLayeringCurve::Count)]{};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTag ViewMode{AlsViewModeTags::ThirdPerson};
 
@@ -70,6 +84,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTag GroundedEntryMode;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsLodState LodState;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsFarLodState FarLodState;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsLayeringState LayeringState;
 
@@ -91,6 +111,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsInAirState InAirState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsMotionMatchingState MotionMatchingState;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsFeetState FeetState;
 
@@ -106,6 +129,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsRagdollingAnimationState RagdollingState;
 
+	// Published at the end of the thread-safe update, before linked animation instances are updated.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsLinkedAnimationState LinkedState;
+
 public:
 	UAlsAnimationInstance();
 
@@ -129,10 +156,30 @@ public:
 	void MarkPendingUpdate();
 
 private:
+	void RefreshLodOnGameThread(float DeltaTime);
+
+	bool IsBoneRequired(const FName& BoneName) const;
+
+public:
+	const FAlsFarLodState& GetFarLodState() const;
+
+private:
+	void RefreshFarLodOnGameThread(float DeltaTime);
+
+	void RefreshLayeringOnGameThread();
+
 	void RefreshLayering();
 
+	float GetLayeringAmountClamped01(EAlsLayeringCurve Curve) const;
+
 	void RefreshPose();
 
+public:
+	const FAlsLinkedAnimationState& GetLinkedState() const;
+
+private:
+	void RefreshLinkedState();
+
 	// View
 
 public:
@@ -219,6 +266,15 @@ private:
 
 	void RefreshInAirLeanAmount(float DeltaTime);
 
+	// Motion Matching
+
+private:
+	void RefreshMotionMatching(float DeltaTime);
+
+	int32 FindMotionMatchingDatabaseIndex() const;
+
+	void RefreshMotionMatchingTrajectory();
+
 	// Feet
 
 private:
@@ -238,6 +294,8 @@ private:
 
 	void RefreshFootOffset(FAlsFootState& FootState, float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const;
 
+	void RefreshFootOffsetTarget(FAlsFootState& FootState, const FVector& FinalLocation) const;
+
 	// Transitions
 
 public:
@@ -307,6 +365,16 @@ inline UAlsAnimationInstanceSettings* UAlsAnimationInstance::GetSettingsUnsafe()
 	return Settings;
 }
 
+inline const FAlsFarLodState& UAlsAnimationInstance::GetFarLodState() const
+{
+	return FarLodState;
+}
+
+inline const FAlsLinkedAnimationState& UAlsAnimationInstance::GetLinkedState() const
+{
+	return LinkedState;
+}
+
 inline void UAlsAnimationInstance::MarkPendingUpdate()
 {
 	bPendingUpdate |= true;
@@ -5,9 +5,11 @@
 #include "Settings/AlsMantlingSettings.h"
 #include "State/AlsLocomotionState.h"
 #include "State/AlsRagdollingState.h"
+#include "State/AlsReplayState.h"
 #include "State/AlsRollingState.h"
 #include "State/AlsViewState.h"
 #include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsStateGate.h"
 #include "AlsCharacter.generated.h"
 
 class UAlsCharacterMovementComponent;
@@ -15,6 +17,8 @@ class UAlsCharacterSettings;
 class UAlsMovementSettings;
 class UAlsAnimationInstance;
 
+using FAlsLocomotionActionChangedDelegate = TMulticastDelegate<void(const FGameplayTag& PreviousLocomotionAction)>;
+
 UCLASS(AutoExpandCategories = ("Settings|Als Character", "Settings|Als Character|Desired State", "State|Als Character"))
 class ALS_API AAlsCharacter : public ACharacter
 {
@@ -76,6 +80,10 @@ protected:
 		ReplicatedUsing = "OnReplicated_RawViewRotation")
 	FRotator RawViewRotation;
 
+	// Replicated instead of the raw view rotation while valid. Set by AI controllers.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Replicated)
+	FAlsViewFocusTarget ViewFocusTarget;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsViewState ViewState;
 
@@ -97,8 +105,21 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRollingState RollingState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	int32 RollingRootMotionSourceId;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_ReplayState")
+	FAlsReplayState ReplayState;
+
+	float ReplayStateUpdateTimeRemaining;
+
 	FTimerHandle BrakingFrictionFactorResetTimer;
 
+public:
+	// Broadcast right after the locomotion action changes, for native code that can't override OnLocomotionActionChanged().
+	FAlsLocomotionActionChangedDelegate LocomotionActionChanged;
+
 public:
 	explicit AAlsCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
@@ -130,8 +151,15 @@ private:
 	void RefreshVisibilityBasedAnimTickOption() const;
 
 public:
+	UAlsCharacterSettings* GetSettings() const;
+
 	bool IsSimulatedProxyTeleported() const;
 
+	// Immediately sets the actual state of the character instead of waiting for it to be refreshed from the desired
+	// state and the movement mode. Intended for restoring a previously recorded state, for example, by a movement replay.
+	void RestoreRecordedState(const FGameplayTag& NewLocomotionMode, const FGameplayTag& NewRotationMode,
+	                          const FGameplayTag& NewStance, const FGameplayTag& NewGait);
+
 	// View Mode
 
 public:
@@ -305,6 +333,12 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
 	void OnLocomotionActionChanged(const FGameplayTag& PreviousLocomotionAction);
 
+	// State Gate
+
+public:
+	UFUNCTION(BlueprintPure, Category = "ALS|Als Character")
+	bool MatchesStateGate(const FAlsStateGate& Gate) const;
+
 	// View
 
 public:
@@ -322,6 +356,12 @@ private:
 public:
 	void CorrectViewNetworkSmoothing(const FRotator& NewViewRotation);
 
+	const FAlsViewFocusTarget& GetViewFocusTarget() const;
+
+	// While the focus target is valid, the raw view rotation is not replicated and simulated proxies calculate the
+	// view rotation from the focus target on their own, without network smoothing. Intended for AI-controlled characters.
+	void SetViewFocusTarget(const FAlsViewFocusTarget& NewFocusTarget);
+
 public:
 	const FAlsViewState& GetViewState() const;
 
@@ -330,6 +370,8 @@ private:
 
 	void RefreshViewNetworkSmoothing(float DeltaTime);
 
+	void RefreshViewFocus(float DeltaTime);
+
 	// Locomotion
 
 public:
@@ -344,6 +386,8 @@ private:
 
 	void RefreshLocomotion(float DeltaTime);
 
+	void RefreshLocomotionInputAndSpeed();
+
 	// Jumping
 
 public:
@@ -362,7 +406,9 @@ private:
 public:
 	virtual void FaceRotation(FRotator NewRotation, float DeltaTime) override final;
 
-	void CharacterMovement_OnPhysicsRotation(float DeltaTime);
+	// Called by the character movement component after each movement update in which the rotation is refreshed with
+	// the fixed time step of the movement instead of on each frame, see UAlsCharacterMovementComponent::bUseFixedTimeStep.
+	virtual void RefreshFixedTimeStepRotation(float DeltaTime);
 
 private:
 	void RefreshGroundedRotation(float DeltaTime);
@@ -426,6 +472,11 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
 	UAnimMontage* SelectRollMontage();
 
+	// Used by the server to validate the montage of a rolling requested by the owning client. Override it
+	// together with SelectRollMontage() if the selected montage depends on the state of the client.
+	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
+	bool IsRollMontageAllowed(UAnimMontage* Montage);
+
 	bool IsRollingAllowedToStart(const UAnimMontage* Montage) const;
 
 private:
@@ -434,14 +485,21 @@ private:
 	UFUNCTION(Server, Reliable)
 	void ServerStartRolling(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
+	void StartClientRolling(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
+
+	void RefreshPendingClientRolling();
+
+	UFUNCTION(Client, Reliable)
+	void ClientCancelRolling(UAnimMontage* Montage);
+
 	UFUNCTION(NetMulticast, Reliable)
 	void MulticastStartRolling(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
 	void StartRollingImplementation(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
-	void RefreshRolling(float DeltaTime);
+	void RefreshRolling();
 
-	void RefreshRollingPhysics(float DeltaTime);
+	void StopRolling();
 
 	// Mantling
 
@@ -457,9 +515,21 @@ private:
 
 	bool TryStartMantling(const FAlsMantlingTraceSettings& TraceSettings);
 
+public:
+	// Traces for a mantleable ledge in the given direction and fills the mantling parameters except for the mantling
+	// type. Doesn't check if mantling is allowed to start, so it can also be used to find ledges for AI navigation.
+	bool TraceMantlingTarget(const FAlsMantlingTraceSettings& TraceSettings, const FVector& ForwardTraceDirection,
+	                         FAlsMantlingParameters& Parameters, FVector& TargetLocation);
+
+private:
 	UFUNCTION(Server, Reliable)
 	void ServerStartMantling(const FAlsMantlingParameters& Parameters);
 
+	bool IsMantlingParametersValid(const FAlsMantlingParameters& Parameters);
+
+	UFUNCTION(Client, Reliable)
+	void ClientCancelMantling(EAlsMantlingType MantlingType);
+
 	UFUNCTION(NetMulticast, Reliable)
 	void MulticastStartMantling(const FAlsMantlingParameters& Parameters);
 
@@ -537,6 +607,14 @@ private:
 
 	void RefreshRagdollingActorTransform(float DeltaTime);
 
+	// Replay
+
+private:
+	void RefreshReplayState(float DeltaTime);
+
+	UFUNCTION()
+	void OnReplicated_ReplayState();
+
 	// Debug
 
 public:
@@ -557,6 +635,11 @@ private:
 	void DisplayDebugMantling(const UCanvas* Canvas, float Scale, float HorizontalLocation, float& VerticalLocation) const;
 };
 
+inline UAlsCharacterSettings* AAlsCharacter::GetSettings() const
+{
+	return Settings;
+}
+
 inline bool AAlsCharacter::IsSimulatedProxyTeleported() const
 {
 	return bSimulatedProxyTeleported;
@@ -622,6 +705,11 @@ inline const FVector& AAlsCharacter::GetInputDirection() const
 	return InputDirection;
 }
 
+inline const FAlsViewFocusTarget& AAlsCharacter::GetViewFocusTarget() const
+{
+	return ViewFocusTarget;
+}
+
 inline const FAlsViewState& AAlsCharacter::GetViewState() const
 {
 	return ViewState;
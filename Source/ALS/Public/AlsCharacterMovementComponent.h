@@ -5,8 +5,6 @@
 #include "Utility/AlsGameplayTags.h"
 #include "AlsCharacterMovementComponent.generated.h"
 
-using FAlsPhysicsRotationDelegate = TMulticastDelegate<void(float DeltaTime)>;
-
 class ALS_API FAlsCharacterNetworkMoveData : public FCharacterNetworkMoveData
 {
 private:
@@ -81,6 +79,21 @@ class ALS_API UAlsCharacterMovementComponent : public UCharacterMovementComponen
 protected:
 	FAlsCharacterNetworkMoveDataContainer MoveDataContainer;
 
+	// If checked, locally controlled characters simulate movement in fixed time steps, and the mesh is interpolated
+	// between them. The character rotation is refreshed after each step instead of on each frame. Client moves are
+	// not combined, and the server replays them with the same steps. This makes movement and rotation independent
+	// of the frame rate, and reduces network corrections.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bUseFixedTimeStep{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings",
+		Meta = (ClampMin = 0.001, EditCondition = "bUseFixedTimeStep", ForceUnits = "s"))
+	float FixedTimeStep{1.0f / 60.0f};
+
+	// Time that doesn't fit into this number of steps is dropped to prevent the simulation from falling further behind on slow frames.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 1, EditCondition = "bUseFixedTimeStep"))
+	int32 MaxFixedTimeStepsPerFrame{4};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TObjectPtr<UAlsMovementSettings> MovementSettings;
 
@@ -106,8 +119,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FVector PendingPenetrationAdjustment;
 
-public:
-	FAlsPhysicsRotationDelegate OnPhysicsRotation;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	float FixedTimeStepAccumulator;
+
+	// Number of fixed time steps simulated during the last tick.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	int32 FixedTimeStepsCount;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FVector FixedTimeStepPreviousLocation;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FVector FixedTimeStepMeshOffset;
 
 public:
 	UAlsCharacterMovementComponent();
@@ -118,6 +141,10 @@ public:
 
 	virtual void BeginPlay() override;
 
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	virtual void OnTeleported() override;
+
 	virtual void SetMovementMode(EMovementMode NewMovementMode, uint8 NewCustomMode = 0) override;
 
 	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
@@ -129,10 +156,6 @@ public:
 protected:
 	virtual void ControlledCharacterMove(const FVector& InputVector, float DeltaTime) override;
 
-public:
-	virtual void PhysicsRotation(float DeltaTime) override;
-
-protected:
 	virtual void PhysWalking(float DeltaTime, int32 Iterations) override;
 
 	virtual void PhysNavWalking(float DeltaTime, int32 Iterations) override;
@@ -153,6 +176,8 @@ protected:
 	                              float SweepRadius, const FHitResult* DownwardSweepResult) const override;
 
 private:
+	void RefreshFixedTimeStepMeshOffset();
+
 	void SavePenetrationAdjustment(const FHitResult& Hit);
 
 	void ApplyPendingPenetrationAdjustment();
@@ -177,6 +202,19 @@ private:
 	void RefreshMaxWalkSpeed();
 
 public:
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character Movement")
+	void SetUseFixedTimeStep(bool bNewUseFixedTimeStep);
+
+	bool IsFixedTimeStepActive() const;
+
+	// Returns true if the character rotation is refreshed after each movement update instead of on each frame. This is the case
+	// for characters that simulate fixed time steps, and on the server for characters whose clients simulate fixed time steps.
+	bool IsFixedTimeStepRotationActive() const;
+
+	float GetFixedTimeStep() const;
+
+	int32 GetFixedTimeStepsCount() const;
+
 	float CalculateGaitAmount() const;
 
 	void SetMovementModeLocked(bool bNewMovementModeLocked);
@@ -186,3 +224,13 @@ inline const FAlsMovementGaitSettings& UAlsCharacterMovementComponent::GetGaitSe
 {
 	return GaitSettings;
 }
+
+inline float UAlsCharacterMovementComponent::GetFixedTimeStep() const
+{
+	return FixedTimeStep;
+}
+
+inline int32 UAlsCharacterMovementComponent::GetFixedTimeStepsCount() const
+{
+	return FixedTimeStepsCount;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Animation/AnimInstance.h"
+#include "State/AlsLinkedAnimationState.h"
 #include "AlsLinkedAnimationInstance.generated.h"
 
 class UAlsAnimationInstance;
@@ -34,6 +35,12 @@ protected:
 	// sure what you're doing, then it's better to access your custom variables through the "Parent" variable.
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Linked Animation Instance", Meta = (BlueprintProtected, BlueprintThreadSafe))
 	UAlsAnimationInstance* GetParentUnsafe() const;
+
+	// Returns a copy of the parent's state that is published at the end of the parent's thread-safe update. Linked
+	// animation instances are updated after that, so this is the preferred way to read the parent's state from
+	// the thread-safe update of linked animation instances. Returns a default state if there is no parent.
+	UFUNCTION(BlueprintPure, Category = "ALS|Als Linked Animation Instance", Meta = (BlueprintProtected, BlueprintThreadSafe))
+	const FAlsLinkedAnimationState& GetParentState() const;
 };
 
 inline UAlsAnimationInstance* UAlsLinkedAnimationInstance::GetParentUnsafe() const
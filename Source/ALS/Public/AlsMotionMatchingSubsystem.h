@@ -0,0 +1,22 @@
+#pragma once
+
+#include <atomic>
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsMotionMatchingSubsystem.generated.h"
+
+// Limits the number of motion matching database searches of all animation instances in the world per frame, so that
+// many characters whose search intervals elapse on the same frame don't search all at once. Thread safe.
+UCLASS()
+class ALS_API UAlsMotionMatchingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	// Frame number in the upper 32 bits and the number of searches started on that frame in the lower 32 bits.
+	std::atomic<uint64> FrameSearches{0};
+
+public:
+	// Returns false if the given number of searches has already been started on this frame. 0 means no limit.
+	bool TryStartSearch(int32 MaxSearchesPerFrame);
+};
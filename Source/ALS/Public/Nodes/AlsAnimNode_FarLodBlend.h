@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Animation/AnimNodeBase.h"
+#include "AlsAnimNode_FarLodBlend.generated.h"
+
+class UAnimSequenceBase;
+
+// Blends the source pose with the far LOD locomotion cycle selected by the ALS animation instance. While the cycle
+// is fully blended in, the source pose is neither updated nor evaluated. Should be placed right before the output pose.
+USTRUCT(BlueprintInternalUseOnly)
+struct ALS_API FAlsAnimNode_FarLodBlend : public FAnimNode_Base
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	FPoseLink SourcePose;
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UAnimSequenceBase> Sequence;
+
+	float Amount{0.0f};
+
+	float Time{0.0f};
+
+public:
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+
+	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
+
+	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) override;
+
+	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
+
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+
+private:
+	void EvaluateCycle(FPoseContext& Output) const;
+};
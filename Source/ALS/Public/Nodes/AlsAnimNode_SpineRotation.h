@@ -0,0 +1,90 @@
+#pragma once
+
+#include "BoneControllers/AnimNode_SkeletalControlBase.h"
+#include "AlsAnimNode_SpineRotation.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsSpineRotationBone
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FBoneReference Bone;
+
+	// Share of the chain rotation applied to this bone, relative to the weights of the other bones in the same chain.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float Weight{1.0f};
+};
+
+// Distributes the view yaw and pitch angles over the spine bones and the look angles over the neck and head
+// bones in a single pass. Bones in both chains should be ordered from root to tip, and each bone should be
+// a descendant of the previous one, so that the rotation of each bone is carried over to the next ones.
+USTRUCT(BlueprintInternalUseOnly)
+struct ALS_API FAlsAnimNode_SpineRotation : public FAnimNode_SkeletalControlBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	TArray<FAlsSpineRotationBone> SpineBones;
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	TArray<FAlsSpineRotationBone> HeadBones;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (PinShownByDefault, ForceUnits = "deg"))
+	float SpineYawAngle{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (PinShownByDefault, ForceUnits = "deg"))
+	float SpinePitchAngle{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (PinShownByDefault, ForceUnits = "deg"))
+	float HeadYawAngle{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (PinShownByDefault, ForceUnits = "deg"))
+	float HeadPitchAngle{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (PinHiddenByDefault, ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
+	float MaxSpineYawAngle{90.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (PinHiddenByDefault, ClampMin = 0, ClampMax = 90, ForceUnits = "deg"))
+	float MaxSpinePitchAngle{90.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (PinHiddenByDefault, ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
+	float MaxHeadYawAngle{90.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (PinHiddenByDefault, ClampMin = 0, ClampMax = 90, ForceUnits = "deg"))
+	float MaxHeadPitchAngle{60.0f};
+
+	// Angles are interpolated towards their inputs at this speed. A value of 0 disables the interpolation.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (PinHiddenByDefault, ClampMin = 0))
+	float InterpolationSpeed{0.0f};
+
+private:
+	bool bReinitializationRequired{true};
+
+	float CurrentSpineYawAngle{0.0f};
+
+	float CurrentSpinePitchAngle{0.0f};
+
+	float CurrentHeadYawAngle{0.0f};
+
+	float CurrentHeadPitchAngle{0.0f};
+
+public:
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+
+	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
+
+	virtual bool IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones) override;
+
+protected:
+	virtual void UpdateInternal(const FAnimationUpdateContext& Context) override;
+
+	virtual void InitializeBoneReferences(const FBoneContainer& RequiredBones) override;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "State/AlsFeetState.h"
 #include "Units/RigUnit.h"
 #include "AlsRigUnits.generated.h"
 
@@ -144,3 +145,70 @@ public:
 	RIGVM_METHOD()
 	virtual void Execute(const FRigUnitContext& Context) override;
 };
+
+// Moves the pelvis down so that both feet can reach their targets, and then solves both legs towards
+// the foot IK targets from the feet state. Foot lock and foot offsets are already baked into these targets.
+USTRUCT(DisplayName = "Apply Feet Ik", Meta = (Category = "ALS"))
+struct ALS_API FAlsRigUnit_ApplyFeetIk : public FAlsRigUnit_HighLevelBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Meta = (Input, ExpandByDefault))
+	FRigElementKey PelvisBone;
+
+	UPROPERTY(Meta = (Input, ExpandByDefault))
+	FRigElementKey LeftThighBone;
+
+	UPROPERTY(Meta = (Input, ExpandByDefault))
+	FRigElementKey LeftCalfBone;
+
+	UPROPERTY(Meta = (Input, ExpandByDefault))
+	FRigElementKey LeftFootBone;
+
+	UPROPERTY(Meta = (Input, ExpandByDefault))
+	FRigElementKey RightThighBone;
+
+	UPROPERTY(Meta = (Input, ExpandByDefault))
+	FRigElementKey RightCalfBone;
+
+	UPROPERTY(Meta = (Input, ExpandByDefault))
+	FRigElementKey RightFootBone;
+
+	UPROPERTY(Meta = (Input))
+	FAlsFeetState FeetState;
+
+	UPROPERTY(Meta = (Input, ClampMin = 0))
+	float PelvisOffsetInterpolationSpeed{15.0f};
+
+	UPROPERTY(Meta = (Input))
+	float Weight{1.0f};
+
+	UPROPERTY(Meta = (Output))
+	float PelvisOffsetZ{0.0f};
+
+	UPROPERTY()
+	FCachedRigElement CachedPelvisBone;
+
+	UPROPERTY()
+	FCachedRigElement CachedLeftThighBone;
+
+	UPROPERTY()
+	FCachedRigElement CachedLeftCalfBone;
+
+	UPROPERTY()
+	FCachedRigElement CachedLeftFootBone;
+
+	UPROPERTY()
+	FCachedRigElement CachedRightThighBone;
+
+	UPROPERTY()
+	FCachedRigElement CachedRightCalfBone;
+
+	UPROPERTY()
+	FCachedRigElement CachedRightFootBone;
+
+public:
+	RIGVM_METHOD()
+	virtual void Execute(const FRigUnitContext& Context) override;
+};
@@ -3,6 +3,7 @@
 #include "GameplayTagContainer.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
 #include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsStateGate.h"
 #include "AlsAnimNotifyState_EarlyBlendOut.generated.h"
 
 UCLASS(DisplayName = "Als Early Blend Out Animation Notify State")
@@ -35,6 +36,12 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (EditCondition = "bCheckStance"))
 	FGameplayTag StanceEquals{AlsStanceTags::Crouching};
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (InlineEditConditionToggle))
+	bool bCheckStateGate{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (EditCondition = "bCheckStateGate"))
+	FAlsStateGate StateGateMatches;
+
 public:
 	UAlsAnimNotifyState_EarlyBlendOut();
 
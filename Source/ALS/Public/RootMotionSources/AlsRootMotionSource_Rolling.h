@@ -0,0 +1,56 @@
+﻿#pragma once
+
+#include "GameFramework/RootMotionSource.h"
+#include "AlsRootMotionSource_Rolling.generated.h"
+
+class UAnimMontage;
+
+USTRUCT()
+struct ALS_API FAlsRootMotionSource_Rolling : public FRootMotionSource
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TObjectPtr<UAnimMontage> Montage{nullptr};
+
+	UPROPERTY(Meta = (ClampMin = 0, ForceUnits = "x"))
+	float PlayRate{1.0f};
+
+	UPROPERTY(Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float StartYawAngle{0.0f};
+
+	UPROPERTY(Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float TargetYawAngle{0.0f};
+
+	UPROPERTY(Meta = (ClampMin = 0))
+	float RotationInterpolationSpeed{0.0f};
+
+public:
+	FAlsRootMotionSource_Rolling();
+
+	virtual FRootMotionSource* Clone() const override;
+
+	virtual bool Matches(const FRootMotionSource* Other) const override;
+
+	virtual void PrepareRootMotion(float SimulationDeltaTime, float DeltaTime, const ACharacter& Character,
+	                               const UCharacterMovementComponent& Movement) override;
+
+	virtual bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess) override;
+
+	virtual UScriptStruct* GetScriptStruct() const override;
+
+	virtual FString ToSimpleString() const override;
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsRootMotionSource_Rolling> : public TStructOpsTypeTraitsBase2<FAlsRootMotionSource_Rolling>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true
+	};
+};
@@ -1,9 +1,12 @@
 ﻿#pragma once
 
+#include "AlsFarLodSettings.h"
 #include "AlsFeetSettings.h"
 #include "AlsGeneralAnimationSettings.h"
 #include "AlsGroundedSettings.h"
 #include "AlsInAirSettings.h"
+#include "AlsLodSettings.h"
+#include "AlsMotionMatchingSettings.h"
 #include "AlsRotateInPlaceSettings.h"
 #include "AlsTransitionsSettings.h"
 #include "AlsTurnInPlaceSettings.h"
@@ -41,6 +44,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsGeneralTurnInPlaceSettings TurnInPlace;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsLodSettings Lod;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsFarLodSettings FarLod;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsMotionMatchingSettings MotionMatching;
+
 public:
 	UAlsAnimationInstanceSettings();
 };
@@ -41,6 +41,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsRollingSettings Rolling;
 
+	// How often the locomotion action state is recorded into server replays. It is also recorded each time
+	// the locomotion action changes. Used to restore locomotion actions when scrubbing a replay.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ReplayStateUpdateInterval{0.5f};
+
 public:
 	UAlsCharacterSettings();
 };
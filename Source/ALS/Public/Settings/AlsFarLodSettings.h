@@ -0,0 +1,63 @@
+﻿#pragma once
+
+#include "GameplayTagContainer.h"
+#include "AlsFarLodSettings.generated.h"
+
+class UAnimSequenceBase;
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsFarLodCycle
+{
+	GENERATED_BODY()
+
+	// An empty tag matches any stance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance;
+
+	// An empty tag matches any gait.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Gait;
+
+	// An empty tag matches any overlay mode.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag OverlayMode;
+
+	// Looped pre-baked locomotion cycle, usually with all layering and IK already applied. When switching between
+	// cycles, the new cycle continues from the same normalized time, so cycles should start at the same phase.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> Sequence;
+
+	// Speed at which the cycle plays at a play rate of 1. Of all matching cycles, the one with the reference
+	// speed closest to the character speed is used. 0 means that the cycle is not speed-matched, such as idle.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
+	float ReferenceSpeed{0.0f};
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsFarLodSettings
+{
+	GENERATED_BODY()
+
+	// The animation instance is replaced by the far LOD cycles when the predicted LOD index is
+	// greater than or equal to this value. 0 means never. Requires the Far LOD Blend node in the animation graph.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 LodThreshold{0};
+
+	// The far LOD cycles are replaced back by the animation instance when the predicted LOD index is less than this
+	// value. Should be less than the value above to prevent switching back and forth around it. 0 means the same value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 ExitLodThreshold{0};
+
+	// How long the predicted LOD must stay on the other side of the threshold before switching. Prevents frequent switching.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SwitchDelay{0.5f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float BlendDuration{0.25f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	FVector2D PlayRateRange{0.5f, 2.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (TitleProperty = "Sequence"))
+	TArray<FAlsFarLodCycle> Cycles;
+};
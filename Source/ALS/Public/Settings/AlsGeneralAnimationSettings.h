@@ -15,6 +15,14 @@ struct ALS_API FAlsGeneralAnimationSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	bool bUseFootIkBones{true};
 
+	// If checked, layering blend amounts are read from float animation attributes of the root bone instead of
+	// animation curves. Unlike curves, attributes are only blended by nodes in which they are present, which reduces
+	// the curve blending cost of the animation graph. Use the Als Convert Layering Curves To Attributes animation
+	// modifier to convert existing animations. Attributes should be present in every animation that contributes to
+	// the layering, otherwise the blended value will be taken only from the animations that contain the attribute.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bUseLayeringAttributes{false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float MovingSmoothSpeedThreshold{150.0f};
 
@@ -0,0 +1,33 @@
+﻿#pragma once
+
+#include "AlsLodSettings.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLodSettings
+{
+	GENERATED_BODY()
+
+	// If checked, features will be disabled if the bones they affect are not required by the current LOD of the skeletal mesh.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bDisableFeaturesForRemovedBones{true};
+
+	// Feet IK and foot locking are disabled when the predicted LOD index is greater than or equal to this value. 0 means never disable.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 FeetLodThreshold{0};
+
+	// Foot offset traces are disabled when the predicted LOD index is greater than or equal to this value. 0 means never disable.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 FootOffsetTracesLodThreshold{0};
+
+	// Leaning is disabled when the predicted LOD index is greater than or equal to this value. 0 means never disable.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 LeanLodThreshold{0};
+
+	// Hand IK is disabled when the predicted LOD index is greater than or equal to this value. 0 means never disable.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 HandIkLodThreshold{0};
+
+	// How fast the feet and hand IK amounts blend in or out when the LOD changes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "x"))
+	float BlendSpeed{4.0f};
+};
@@ -129,4 +129,14 @@ struct ALS_API FAlsGeneralMantlingSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TArray<TEnumAsByte<EObjectTypeQuery>> MantlingTraceObjectTypes;
+
+	// If checked, the server validates mantling parameters received from clients against its own collision
+	// and rejects the ones that are unreachable, outside the ledge height range, or not standable.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bValidateOnServer{true};
+
+	// Distance tolerance used during validation to compensate for network quantization and latency.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bValidateOnServer", ForceUnits = "cm"))
+	float ServerValidationTolerance{25.0f};
 };
@@ -0,0 +1,59 @@
+﻿#pragma once
+
+#include "GameplayTagContainer.h"
+#include "AlsMotionMatchingSettings.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsMotionMatchingDatabase
+{
+	GENERATED_BODY()
+
+	// An empty tag matches any stance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance;
+
+	// An empty tag matches any gait.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Gait;
+
+	// An empty tag matches any rotation mode.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag RotationMode;
+
+	// An empty tag matches any overlay mode.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag OverlayMode;
+
+	// Pose search database that is searched while this entry is selected. Only the database of the first
+	// matching entry is searched, so more specific entries should be placed before more general ones.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (AllowedClasses = "/Script/PoseSearch.PoseSearchDatabase"))
+	TObjectPtr<UObject> Database;
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsMotionMatchingSettings
+{
+	GENERATED_BODY()
+
+	// If checked, cycle blending, stride blending and play rates of the grounded locomotion are not calculated, because
+	// the locomotion is expected to be driven by a pose search node that uses the database and the trajectory from
+	// the motion matching state. Layering, feet and overlays are still driven by the animation instance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bEnabled{false};
+
+	// Minimum time between two database searches. A search is also requested immediately when the selected database changes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, EditCondition = "bEnabled", ForceUnits = "s"))
+	float SearchInterval{0.1f};
+
+	// Maximum number of database searches of all characters in the world per frame. Characters over the budget
+	// search on one of the next frames instead. Searches requested by database changes are not limited. 0 means no limit.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, EditCondition = "bEnabled"))
+	int32 MaxSearchesPerFrame{0};
+
+	// Future times at which the trajectory is sampled. Should be sorted in ascending order.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnabled", ForceUnits = "s"))
+	TArray<float> TrajectorySampleTimes{0.2f, 0.4f, 0.8f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnabled"))
+	TArray<FAlsMotionMatchingDatabase> Databases;
+};
@@ -34,6 +34,23 @@ public:
 
 public:
 	float GetSpeedForGait(const FGameplayTag& Gait) const;
+
+	// The functions below depend only on these settings and their arguments, not on the state of the character or its
+	// movement component, so they can be used by movement simulations running outside the game thread as well.
+
+	// Maps the speed to the configured movement speeds ranging from 0 to 3,
+	// where 0 is stopped, 1 is walking, 2 is running, and 3 is sprinting.
+	float CalculateGaitAmount(float Speed) const;
+
+	// The curve must be valid when calling these functions.
+
+	float CalculateMaxAcceleration(float GaitAmount) const;
+
+	float CalculateMaxBrakingDeceleration(float GaitAmount) const;
+
+	float CalculateGroundFriction(float GaitAmount) const;
+
+	float CalculateRotationInterpolationSpeed(float GaitAmount) const;
 };
 
 inline float FAlsMovementGaitSettings::GetSpeedForGait(const FGameplayTag& Gait) const
@@ -82,4 +99,57 @@ public:
 		{AlsRotationModeTags::LookingDirection, {}},
 		{AlsRotationModeTags::Aiming, {}}
 	};
+
+	// Rotation modes and stances that have gait settings, built from the settings above when the settings are loaded or changed.
+	// The native rotation modes and stances always come first, followed by custom ones in the order they were found.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", Transient, AdvancedDisplay)
+	TArray<FGameplayTag> RotationModeTags;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", Transient, AdvancedDisplay)
+	TArray<FGameplayTag> StanceTags;
+
+	// Gait settings of all rotation mode and stance combinations, indexed by GetGaitSettingsIndex().
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", Transient, AdvancedDisplay)
+	TArray<FAlsMovementGaitSettings> GaitSettings;
+
+	// Whether the gait settings with the same index were configured. Combinations of a rotation mode and a stance
+	// without configured settings keep a default entry so that every index stays valid, but can't be found.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", Transient, AdvancedDisplay)
+	TArray<bool> GaitSettingsValid;
+
+public:
+	UAlsMovementSettings();
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	void Initialize();
+
+	int32 GetGaitSettingsIndex(const FGameplayTag& RotationMode, const FGameplayTag& Stance) const;
+
+	const FAlsMovementGaitSettings* FindGaitSettings(const FGameplayTag& RotationMode, const FGameplayTag& Stance) const;
+
+	const FAlsMovementGaitSettings* FindGaitSettings(int32 Index) const;
 };
+
+inline int32 UAlsMovementSettings::GetGaitSettingsIndex(const FGameplayTag& RotationMode, const FGameplayTag& Stance) const
+{
+	const auto RotationModeIndex{RotationModeTags.IndexOfByKey(RotationMode)};
+	const auto StanceIndex{StanceTags.IndexOfByKey(Stance)};
+
+	return RotationModeIndex >= 0 && StanceIndex >= 0 ? RotationModeIndex * StanceTags.Num() + StanceIndex : INDEX_NONE;
+}
+
+inline const FAlsMovementGaitSettings* UAlsMovementSettings::FindGaitSettings(const FGameplayTag& RotationMode,
+                                                                              const FGameplayTag& Stance) const
+{
+	return FindGaitSettings(GetGaitSettingsIndex(RotationMode, Stance));
+}
+
+inline const FAlsMovementGaitSettings* UAlsMovementSettings::FindGaitSettings(const int32 Index) const
+{
+	return GaitSettings.IsValidIndex(Index) && GaitSettingsValid[Index] ? &GaitSettings[Index] : nullptr;
+}
@@ -11,6 +11,11 @@ struct ALS_API FAlsRollingSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UAnimMontage> Montage{nullptr};
 
+	// Other montages that AAlsCharacter::SelectRollMontage() may return. The server accepts
+	// rolling requests from clients only with the montages listed here or the one above.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<TObjectPtr<UAnimMontage>> AdditionalMontages;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	bool bCrouchOnStart{true};
 
@@ -20,6 +25,15 @@ struct ALS_API FAlsRollingSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
 	float RotationInterpolationSpeed{10.0f};
 
+	// Play rates requested by clients are clamped to this value on the server.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "x"))
+	float MaxPlayRate{2.0f};
+
+	// Maximum allowed difference between the yaw angles requested by a client and the ones
+	// expected by the server. Yaw angles outside this range are replaced with the server ones.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
+	float ServerYawAngleTolerance{30.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	bool bStartRollingOnLand{true};
 
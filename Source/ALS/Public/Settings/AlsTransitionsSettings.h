@@ -1,9 +1,31 @@
 ﻿#pragma once
 
+#include "GameplayTagContainer.h"
 #include "AlsTransitionsSettings.generated.h"
 
 class UAnimSequenceBase;
 
+USTRUCT(BlueprintType)
+struct ALS_API FAlsStanceTransitionAnimations
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> TransitionLeftAnimation{nullptr};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> TransitionRightAnimation{nullptr};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> DynamicTransitionLeftAnimation{nullptr};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> DynamicTransitionRightAnimation{nullptr};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsTransitionsSettings
 {
@@ -53,4 +75,17 @@ struct ALS_API FAlsTransitionsSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UAnimSequenceBase> CrouchingDynamicTransitionRightAnimation{nullptr};
+
+	// Transition animations of custom stances. The standing and crouching stances always use the animations
+	// above, so entries with these stances are ignored. Stances without an entry use the standing animations.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (TitleProperty = "Stance"))
+	TArray<FAlsStanceTransitionAnimations> AdditionalStanceAnimations;
+
+public:
+	UAnimSequenceBase* GetTransitionAnimation(const FGameplayTag& Stance, bool bLeft) const;
+
+	UAnimSequenceBase* GetDynamicTransitionAnimation(const FGameplayTag& Stance, bool bLeft) const;
+
+private:
+	const FAlsStanceTransitionAnimations* FindAdditionalStanceAnimations(const FGameplayTag& Stance) const;
 };
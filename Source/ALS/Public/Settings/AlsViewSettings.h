@@ -12,4 +12,8 @@ struct ALS_API FAlsViewSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
 	bool bEnableListenServerNetworkSmoothing{true};
+
+	// Interpolation speed of the view rotation towards the focus target. Zero means no interpolation.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0))
+	float FocusInterpolationSpeed{10.0f};
 };
@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include "GameplayTagContainer.h"
+#include "State/AlsFeetState.h"
+#include "State/AlsLayeringState.h"
+#include "State/AlsLocomotionAnimationState.h"
+#include "State/AlsViewAnimationState.h"
+#include "Utility/AlsGameplayTags.h"
+#include "AlsLinkedAnimationState.generated.h"
+
+// Read-only copy of the parent animation instance state that is published once per
+// update, so that linked animation instances always see values from the same frame.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLinkedAnimationState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag ViewMode{AlsViewModeTags::ThirdPerson};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag LocomotionMode{AlsLocomotionModeTags::Grounded};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag RotationMode{AlsRotationModeTags::LookingDirection};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance{AlsStanceTags::Standing};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Gait{AlsGaitTags::Walking};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag OverlayMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag LocomotionAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsLayeringState Layering;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsViewAnimationState View;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsLocomotionAnimationState Locomotion;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsFeetState Feet;
+};
@@ -0,0 +1,35 @@
+﻿#pragma once
+
+#include "AlsLodState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLodState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -1))
+	int32 PredictedLod{INDEX_NONE};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bFeetAllowed{true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bFootOffsetTracesAllowed{true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bLeanAllowed{true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bHandIkAllowed{true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float FeetAmount{1.0f};
+
+	// Should be used in the animation blueprint as a multiplier for the hand IK alpha.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float HandIkAmount{1.0f};
+
+	// Whether the allowed features still need to be gated by the required bones of the skeletal
+	// mesh, which are recalculated for the predicted LOD only after the animation update.
+	bool bRequiredBonesCheckPending{false};
+};
@@ -0,0 +1,30 @@
+﻿#pragma once
+
+#include "AlsMotionMatchingState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsMotionMatchingState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -1))
+	int32 DatabaseIndex{INDEX_NONE};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UObject> Database;
+
+	// True for a single update when the pose search node is allowed to search the database.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bSearchRequested{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SearchTimeRemaining{0.0f};
+
+	// Predicted locations relative to the character, one for each trajectory sample time.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FVector> TrajectoryLocations;
+
+	// Predicted velocities relative to the character, one for each trajectory sample time.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FVector> TrajectoryVelocities;
+};
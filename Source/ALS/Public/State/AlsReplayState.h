@@ -0,0 +1,40 @@
+﻿#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Engine/NetSerialization.h"
+#include "AlsReplayState.generated.h"
+
+class UAnimMontage;
+
+// Periodic checkpoint of the locomotion action state, which is only recorded into replays. Locomotion actions
+// are started by multicast RPCs, which are lost when scrubbing a replay, so this state is used to restore them.
+// The RPCs are still recorded as well, so this state adds to the replay size rather than reducing it.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsReplayState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag LocomotionAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimMontage> ActionMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ActionMontagePosition{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector_NetQuantize RagdollPelvisLocation;
+
+public:
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsReplayState> : public TStructOpsTypeTraitsBase2<FAlsReplayState>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
@@ -2,6 +2,8 @@
 
 #include "AlsRollingState.generated.h"
 
+class UAnimMontage;
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsRollingState
 {
@@ -9,4 +11,23 @@ struct ALS_API FAlsRollingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
 	float TargetYawAngle{0.0f};
+
+	// Rolling requested by the owning client while the character was still in the air on the server. Rolling
+	// on landing is started on the client during the landing move, and the server processes that move only
+	// after receiving the request, so the request is validated once the character lands on the server too.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimMontage> PendingMontage{nullptr};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "x"))
+	float PendingPlayRate{1.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float PendingStartYawAngle{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float PendingTargetYawAngle{0.0f};
+
+	// World time at which the pending rolling was requested.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	float PendingRequestTime{0.0f};
 };
@@ -29,6 +29,23 @@ struct ALS_API FAlsViewNetworkSmoothingState
 	FRotator Rotation{ForceInit};
 };
 
+// Compact replacement for the replicated view rotation of AI-controlled characters.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsViewFocusTarget
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bValid{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TWeakObjectPtr<AActor> Actor;
+
+	// Used if the focus actor is not set or is not relevant.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector_NetQuantize Location{ForceInit};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsViewState
 {
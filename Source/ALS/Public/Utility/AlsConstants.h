@@ -3,6 +3,32 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "AlsConstants.generated.h"
 
+// Index of a layering curve in UAlsConstants::LayeringCurveNames(), used to read layering values without looking them up by name.
+enum class EAlsLayeringCurve : uint8
+{
+	Head,
+	HeadAdditive,
+	HeadSlot,
+	ArmLeft,
+	ArmLeftAdditive,
+	ArmLeftSlot,
+	ArmLeftLocalSpace,
+	ArmRight,
+	ArmRightAdditive,
+	ArmRightSlot,
+	ArmRightLocalSpace,
+	HandLeft,
+	HandRight,
+	Spine,
+	SpineAdditive,
+	SpineSlot,
+	Pelvis,
+	PelvisSlot,
+	Legs,
+	LegsSlot,
+	Count
+};
+
 UCLASS(Meta = (BlueprintThreadSafe))
 class ALS_API UAlsConstants : public UBlueprintFunctionLibrary
 {
@@ -120,6 +146,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ALS|Als Constants|Animation Curves")
 	static const FName& LayerLegsSlotCurveName();
 
+	// All layering curve names, indexed by EAlsLayeringCurve.
+	UFUNCTION(BlueprintPure, Category = "ALS|Als Constants|Animation Curves")
+	static const TArray<FName>& LayeringCurveNames();
+
 	UFUNCTION(BlueprintPure, Category = "ALS|Als Constants|Animation Curves")
 	static const FName& HandLeftIkCurveName();
 
@@ -423,6 +453,38 @@ inline const FName& UAlsConstants::LayerLegsSlotCurveName()
 	return Name;
 }
 
+inline const TArray<FName>& UAlsConstants::LayeringCurveNames()
+{
+	static const FName NamesArray[]
+	{
+		LayerHeadCurveName(),
+		LayerHeadAdditiveCurveName(),
+		LayerHeadSlotCurveName(),
+		LayerArmLeftCurveName(),
+		LayerArmLeftAdditiveCurveName(),
+		LayerArmLeftSlotCurveName(),
+		LayerArmLeftLocalSpaceCurveName(),
+		LayerArmRightCurveName(),
+		LayerArmRightAdditiveCurveName(),
+		LayerArmRightSlotCurveName(),
+		LayerArmRightLocalSpaceCurveName(),
+		LayerHandLeftCurveName(),
+		LayerHandRightCurveName(),
+		LayerSpineCurveName(),
+		LayerSpineAdditiveCurveName(),
+		LayerSpineSlotCurveName(),
+		LayerPelvisCurveName(),
+		LayerPelvisSlotCurveName(),
+		LayerLegsCurveName(),
+		LayerLegsSlotCurveName()
+	};
+
+	static_assert(UE_ARRAY_COUNT(NamesArray) == static_cast<uint8>(EAlsLayeringCurve::Count));
+
+	static const TArray<FName> Names{NamesArray, UE_ARRAY_COUNT(NamesArray)};
+	return Names;
+}
+
 inline const FName& UAlsConstants::HandLeftIkCurveName()
 {
 	static const FName Name{TEXT("HandLeftIk")};
@@ -60,6 +60,12 @@ class ALS_API UAlsMath : public UBlueprintFunctionLibrary
 public:
 	static constexpr auto CounterClockwiseRotationAngleThreshold{5.0f};
 
+	// Springs are substepped with at most this delta time to stay stable when the delta time
+	// is large, for example, when animation updates are skipped by update rate optimizations.
+	static constexpr auto SpringDampMaxSubstepDeltaTime{1.0f / 60.0f};
+
+	static constexpr auto SpringDampMaxSubstepsCount{8};
+
 public:
 	UFUNCTION(BlueprintPure, Category = "ALS|Als Math")
 	static float Clamp01(float Value);
@@ -255,6 +261,14 @@ inline FRotator UAlsMath::ExponentialDecay(const FRotator& Current, const FRotat
 		       : Target;
 }
 
+template <>
+inline FQuat UAlsMath::ExponentialDecay(const FQuat& Current, const FQuat& Target, const float DeltaTime, const float Lambda)
+{
+	return Lambda > 0.0f
+		       ? FQuat::Slerp(Current, Target, ExponentialDecay(DeltaTime, Lambda))
+		       : Target;
+}
+
 inline float UAlsMath::DampAngle(const float Current, const float Target, const float DeltaTime, const float Smoothing)
 {
 	return Smoothing > 0.0f
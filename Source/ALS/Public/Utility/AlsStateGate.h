@@ -0,0 +1,90 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "AlsStateGate.generated.h"
+
+// Gameplay tag query over the character state tags (view mode, locomotion mode, rotation mode, stance, gait, overlay
+// mode and locomotion action). The query is compiled into bitmask tests over a state word in which each native ALS
+// tag has its own bit, so that checking it doesn't walk the gameplay tag tables. If the state contains tags that
+// are not native ALS tags, the query is evaluated as a regular gameplay tag query instead. The query is compiled
+// when it's set or loaded, so the gate is never modified while matching and can be used from any thread.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsStateGate
+{
+	GENERATED_BODY()
+
+private:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (AllowPrivateAccess))
+	FGameplayTagQuery Query;
+
+	struct FOperation
+	{
+		EGameplayTagQueryExprType Type{EGameplayTagQueryExprType::Undefined};
+
+		// Number of operations in the subtree of this operation, including itself.
+		int32 SubtreeSize{1};
+
+		// Range of tag masks in the masks array, used only by tag operations.
+		int32 FirstMaskIndex{0};
+
+		int32 NumMasks{0};
+	};
+
+	TArray<FOperation> Operations;
+
+	TArray<uint32> Masks;
+
+#if WITH_EDITORONLY_DATA
+	// Query from which the operations were compiled. The query can be changed in the editor
+	// without the gate being notified, in which case the gate falls back to the query itself.
+	FGameplayTagQuery CompiledQuery;
+#endif
+
+public:
+	FAlsStateGate() = default;
+
+	explicit FAlsStateGate(const FGameplayTagQuery& NewQuery);
+
+	void PostSerialize(const FArchive& Archive);
+
+	const FGameplayTagQuery& GetQuery() const;
+
+	void SetQuery(const FGameplayTagQuery& NewQuery);
+
+	bool IsEmpty() const;
+
+	// Returns false if any of the tags is not a native ALS tag, in which case the state can't be represented by the word.
+	static bool TryMakeStateWord(TConstArrayView<FGameplayTag> StateTags, uint32& StateWord);
+
+	bool Matches(TConstArrayView<FGameplayTag> StateTags) const;
+
+	bool Matches(uint32 StateWord) const;
+
+private:
+	void Compile();
+
+	void CompileExpression(const FGameplayTagQueryExpression& Expression);
+
+	bool IsCompiled() const;
+
+	bool EvaluateOperation(int32 OperationIndex, uint32 StateWord) const;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsStateGate> : public TStructOpsTypeTraitsBase2<FAlsStateGate>
+{
+	enum
+	{
+		WithPostSerialize = true
+	};
+};
+
+inline const FGameplayTagQuery& FAlsStateGate::GetQuery() const
+{
+	return Query;
+}
+
+inline bool FAlsStateGate::IsEmpty() const
+{
+	return Query.IsEmpty();
+}
@@ -8,7 +8,7 @@ public class ALSEditor : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new[]
 		{
-			"Core", "CoreUObject", "Engine", "AnimationModifiers", "AnimationBlueprintLibrary", "ALS"
+			"Core", "CoreUObject", "Engine", "AssetRegistry", "AnimationModifiers", "AnimationBlueprintLibrary", "ALS", "ALSCamera"
 		});
 
 		if (Target.bBuildEditor)
@@ -0,0 +1,132 @@
+#include "Commandlets/AlsCurveBudgetCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Animation/AnimSequence.h"
+#include "Misc/PackageName.h"
+#include "UObject/SavePackage.h"
+#include "Utility/AlsCurveBudgetUtility.h"
+#include "Utility/AlsLog.h"
+
+UAlsCurveBudgetCommandlet::UAlsCurveBudgetCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAlsCurveBudgetCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	const auto* Path{ParamsMap.Find(TEXT("Path"))};
+	const auto* KnownCurves{ParamsMap.Find(TEXT("KnownCurves"))};
+	const auto* Tolerance{ParamsMap.Find(TEXT("Tolerance"))};
+
+	const auto bVerbose{Switches.Contains(TEXT("Verbose"))};
+	const auto bSave{Switches.Contains(TEXT("Save"))};
+
+	auto PruneFlags{EAlsCurvePruneFlags::None};
+
+	if (Switches.Contains(TEXT("Collapse")))
+	{
+		PruneFlags |= EAlsCurvePruneFlags::CollapseConstantCurves;
+	}
+
+	if (Switches.Contains(TEXT("StripZero")))
+	{
+		PruneFlags |= EAlsCurvePruneFlags::StripConstantZeroCurves;
+	}
+
+	if (Switches.Contains(TEXT("StripUnknown")))
+	{
+		PruneFlags |= EAlsCurvePruneFlags::StripUnknownCurves;
+	}
+
+	TArray<FName> AdditionalKnownCurveNames;
+
+	if (KnownCurves != nullptr)
+	{
+		TArray<FString> CurveNames;
+		KnownCurves->ParseIntoArray(CurveNames, TEXT(","));
+
+		for (const auto& CurveName : CurveNames)
+		{
+			AdditionalKnownCurveNames.Add(FName{*CurveName.TrimStartAndEnd()});
+		}
+	}
+
+	const auto ConstantTolerance{Tolerance != nullptr ? FCString::Atof(**Tolerance) : 0.0001f};
+
+	auto& AssetRegistry{FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get()};
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassNames.Add(UAnimSequence::StaticClass()->GetFName());
+	Filter.PackagePaths.Add(FName{Path != nullptr ? **Path : TEXT("/Game")});
+	Filter.bRecursiveClasses = true;
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	auto TotalNumCurves{0};
+	auto TotalNumKeys{0};
+	auto TotalNumConstantCurves{0};
+	auto TotalNumUnknownCurves{0};
+	auto TotalNumPrunedCurves{0};
+
+	for (const auto& Asset : Assets)
+	{
+		auto* Sequence{Cast<UAnimSequence>(Asset.GetAsset())};
+		if (!IsValid(Sequence))
+		{
+			continue;
+		}
+
+		const auto Report{UAlsCurveBudgetUtility::AnalyzeSequence(Sequence, AdditionalKnownCurveNames, ConstantTolerance)};
+
+		UE_LOG(LogAls, Display, TEXT("%s"), *UAlsCurveBudgetUtility::ReportToString(Report, bVerbose));
+
+		TotalNumCurves += Report.Curves.Num();
+		TotalNumKeys += Report.NumKeys;
+		TotalNumConstantCurves += Report.NumConstantCurves;
+		TotalNumUnknownCurves += Report.NumUnknownCurves;
+
+		if (PruneFlags == EAlsCurvePruneFlags::None)
+		{
+			continue;
+		}
+
+		const auto NumPrunedCurves{UAlsCurveBudgetUtility::PruneSequence(Sequence, Report, static_cast<int32>(PruneFlags))};
+		if (NumPrunedCurves <= 0)
+		{
+			continue;
+		}
+
+		TotalNumPrunedCurves += NumPrunedCurves;
+
+		if (bSave)
+		{
+			auto* Package{Sequence->GetPackage()};
+			const auto FileName{FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension())};
+
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+
+			if (!UPackage::SavePackage(Package, Sequence, *FileName, SaveArgs))
+			{
+				UE_LOG(LogAls, Error, __FUNCTION__ TEXT(": Failed to save %s."), *FileName);
+			}
+		}
+	}
+
+	UE_LOG(LogAls, Display, TEXT("%d sequences, %d curves, %d keys, %d constant, %d unknown, %d pruned."),
+	       Assets.Num(), TotalNumCurves, TotalNumKeys, TotalNumConstantCurves, TotalNumUnknownCurves, TotalNumPrunedCurves);
+
+	return 0;
+}
@@ -0,0 +1,73 @@
+﻿#include "Modifiers/AlsAnimationModifier_ConvertLayeringCurvesToAttributes.h"
+
+#include "Animation/AnimSequence.h"
+#include "Animation/BuiltInAttributeTypes.h"
+#include "Animation/AnimData/AnimDataModel.h"
+
+void UAlsAnimationModifier_ConvertLayeringCurvesToAttributes::OnApply_Implementation(UAnimSequence* Sequence)
+{
+	Super::OnApply_Implementation(Sequence);
+
+	auto& Controller{Sequence->GetController()};
+
+	TArray<float> CurveTimes;
+	TArray<float> CurveValues;
+	TArray<FFloatAnimationAttribute> AttributeValues;
+
+	for (const auto& CurveName : CurveNames)
+	{
+		const auto bCurveExists{UAnimationBlueprintLibrary::DoesCurveExist(Sequence, CurveName, ERawCurveTrackTypes::RCT_Float)};
+		if (!bCurveExists && !bCreateMissingAttributes)
+		{
+			continue;
+		}
+
+		CurveTimes.Reset();
+		CurveValues.Reset();
+
+		if (bCurveExists)
+		{
+			UAnimationBlueprintLibrary::GetFloatKeys(Sequence, CurveName, CurveTimes, CurveValues);
+		}
+
+		if (CurveTimes.IsEmpty())
+		{
+			CurveTimes.Add(Sequence->GetTimeAtFrame(0));
+			CurveValues.Add(bCurveExists ? 0.0f : MissingAttributeValue);
+		}
+
+		AttributeValues.Reset(CurveValues.Num());
+
+		for (const auto CurveValue : CurveValues)
+		{
+			AttributeValues.AddDefaulted_GetRef().Value = CurveValue;
+		}
+
+		const auto AttributeIdentifier{
+			UAnimationAttributeIdentifierExtensions::CreateAttributeIdentifier(Sequence, CurveName, UAlsConstants::RootBoneName(),
+			                                                                   FFloatAnimationAttribute::StaticStruct())
+		};
+
+		Controller.RemoveAttribute(AttributeIdentifier);
+		Controller.AddAttribute(AttributeIdentifier);
+		Controller.SetTypedAttributeKeys<FFloatAnimationAttribute>(AttributeIdentifier, CurveTimes, AttributeValues);
+
+		if (bCurveExists && bRemoveCurves)
+		{
+			UAnimationBlueprintLibrary::RemoveCurve(Sequence, CurveName);
+		}
+	}
+}
+
+void UAlsAnimationModifier_ConvertLayeringCurvesToAttributes::OnRevert_Implementation(UAnimSequence* Sequence)
+{
+	Super::OnRevert_Implementation(Sequence);
+
+	auto& Controller{Sequence->GetController()};
+
+	for (const auto& CurveName : CurveNames)
+	{
+		Controller.RemoveAttribute(UAnimationAttributeIdentifierExtensions::CreateAttributeIdentifier(
+			Sequence, CurveName, UAlsConstants::RootBoneName(), FFloatAnimationAttribute::StaticStruct()));
+	}
+}
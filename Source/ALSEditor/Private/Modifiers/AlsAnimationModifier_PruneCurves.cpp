@@ -0,0 +1,17 @@
+﻿#include "Modifiers/AlsAnimationModifier_PruneCurves.h"
+
+#include "Animation/AnimSequence.h"
+#include "Utility/AlsLog.h"
+
+void UAlsAnimationModifier_PruneCurves::OnApply_Implementation(UAnimSequence* Sequence)
+{
+	Super::OnApply_Implementation(Sequence);
+
+	const auto Report{UAlsCurveBudgetUtility::AnalyzeSequence(Sequence, AdditionalKnownCurveNames, ConstantTolerance)};
+
+	UE_LOG(LogAls, Log, TEXT("%s"), *UAlsCurveBudgetUtility::ReportToString(Report, true));
+
+	const auto NumPrunedCurves{UAlsCurveBudgetUtility::PruneSequence(Sequence, Report, Flags)};
+
+	UE_LOG(LogAls, Log, __FUNCTION__ TEXT(": %d curves pruned in %s."), NumPrunedCurves, *Sequence->GetName());
+}
@@ -0,0 +1,20 @@
+#include "Nodes/AlsAnimGraphNode_FarLodBlend.h"
+
+#define LOCTEXT_NAMESPACE "AlsFarLodBlendAnimationGraphNode"
+
+FText UAlsAnimGraphNode_FarLodBlend::GetNodeTitle(const ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("Title", "Blend Far LOD Cycle");
+}
+
+FText UAlsAnimGraphNode_FarLodBlend::GetTooltipText() const
+{
+	return LOCTEXT("Tooltip", "Blend Far LOD Cycle");
+}
+
+FString UAlsAnimGraphNode_FarLodBlend::GetNodeCategory() const
+{
+	return TEXT("ALS");
+}
+
+#undef LOCTEXT_NAMESPACE
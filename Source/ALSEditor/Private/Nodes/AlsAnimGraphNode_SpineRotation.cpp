@@ -0,0 +1,30 @@
+#include "Nodes/AlsAnimGraphNode_SpineRotation.h"
+
+#define LOCTEXT_NAMESPACE "AlsSpineRotationAnimationGraphNode"
+
+FText UAlsAnimGraphNode_SpineRotation::GetNodeTitle(const ENodeTitleType::Type TitleType) const
+{
+	return GetControllerDescription();
+}
+
+FText UAlsAnimGraphNode_SpineRotation::GetTooltipText() const
+{
+	return LOCTEXT("Tooltip", "Distributes the view and look rotations over the spine, neck and head bones.");
+}
+
+FString UAlsAnimGraphNode_SpineRotation::GetNodeCategory() const
+{
+	return TEXT("ALS");
+}
+
+FText UAlsAnimGraphNode_SpineRotation::GetControllerDescription() const
+{
+	return LOCTEXT("Title", "Rotate Spine");
+}
+
+const FAnimNode_SkeletalControlBase* UAlsAnimGraphNode_SpineRotation::GetNode() const
+{
+	return &Node;
+}
+
+#undef LOCTEXT_NAMESPACE
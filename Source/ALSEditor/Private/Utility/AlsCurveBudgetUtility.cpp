@@ -0,0 +1,195 @@
+#include "Utility/AlsCurveBudgetUtility.h"
+
+#include "AnimationBlueprintLibrary.h"
+#include "Animation/AnimSequence.h"
+#include "Utility/AlsCameraConstants.h"
+#include "Utility/AlsConstants.h"
+#include "Utility/AlsMacros.h"
+
+const TArray<FName>& UAlsCurveBudgetUtility::GetKnownCurveNames()
+{
+	static const auto Names{
+		[]
+		{
+			auto Result{UAlsConstants::LayeringCurveNames()};
+
+			Result.Append(
+			{
+				UAlsConstants::HandLeftIkCurveName(),
+				UAlsConstants::HandRightIkCurveName(),
+
+				UAlsConstants::ViewBlockCurveName(),
+				UAlsConstants::AllowAimingCurveName(),
+
+				UAlsConstants::HipsDirectionLockCurveName(),
+
+				UAlsConstants::PoseGaitCurveName(),
+				UAlsConstants::PoseMovingCurveName(),
+				UAlsConstants::PoseStandingCurveName(),
+				UAlsConstants::PoseCrouchingCurveName(),
+				UAlsConstants::PoseGroundedCurveName(),
+				UAlsConstants::PoseInAirCurveName(),
+
+				UAlsConstants::FootLeftIkCurveName(),
+				UAlsConstants::FootLeftLockCurveName(),
+				UAlsConstants::FootRightIkCurveName(),
+				UAlsConstants::FootRightLockCurveName(),
+				UAlsConstants::FootPlantedCurveName(),
+				UAlsConstants::FeetCrossingCurveName(),
+
+				UAlsConstants::RotationYawSpeedCurveName(),
+				UAlsConstants::RotationYawOffsetCurveName(),
+
+				UAlsConstants::AllowTransitionsCurveName(),
+				UAlsConstants::SprintBlockCurveName(),
+				UAlsConstants::GroundPredictionBlockCurveName(),
+				UAlsConstants::FootstepSoundBlockCurveName(),
+
+				UAlsCameraConstants::CameraOffsetXCurveName(),
+				UAlsCameraConstants::CameraOffsetYCurveName(),
+				UAlsCameraConstants::CameraOffsetZCurveName(),
+				UAlsCameraConstants::PivotOffsetXCurveName(),
+				UAlsCameraConstants::PivotOffsetYCurveName(),
+				UAlsCameraConstants::PivotOffsetZCurveName(),
+				UAlsCameraConstants::LocationLagXCurveName(),
+				UAlsCameraConstants::LocationLagYCurveName(),
+				UAlsCameraConstants::LocationLagZCurveName(),
+				UAlsCameraConstants::RotationLagCurveName(),
+				UAlsCameraConstants::FirstPersonOverrideCurveName(),
+				UAlsCameraConstants::TraceOverrideCurveName()
+			});
+
+			return Result;
+		}()
+	};
+
+	return Names;
+}
+
+FAlsCurveBudgetReport UAlsCurveBudgetUtility::AnalyzeSequence(const UAnimSequence* Sequence, const TArray<FName>& AdditionalKnownCurveNames,
+                                                              const float ConstantTolerance)
+{
+	FAlsCurveBudgetReport Report;
+
+	if (!ALS_ENSURE(IsValid(Sequence)))
+	{
+		return Report;
+	}
+
+	Report.SequenceName = Sequence->GetPathName();
+
+	const auto& FloatCurves{Sequence->GetCurveData().FloatCurves};
+	Report.Curves.Reserve(FloatCurves.Num());
+
+	for (const auto& FloatCurve : FloatCurves)
+	{
+		const auto& Keys{FloatCurve.FloatCurve.GetConstRefOfKeys()};
+
+		auto& Entry{Report.Curves.AddDefaulted_GetRef()};
+		Entry.Name = FloatCurve.Name.DisplayName;
+		Entry.NumKeys = Keys.Num();
+		Entry.bKnown = GetKnownCurveNames().Contains(Entry.Name) || AdditionalKnownCurveNames.Contains(Entry.Name);
+
+		// A curve without keys is treated as constant, because it always evaluates to its default value. Otherwise, all
+		// keys must have the same value, and cubic keys must also have flat tangents, because a cubic curve with equal
+		// key values but non-zero tangents still overshoots between keys and during linear extrapolation.
+
+		Entry.bConstant = true;
+		Entry.ConstantValue = Keys.Num() > 0 ? Keys[0].Value : FloatCurve.FloatCurve.GetDefaultValue();
+
+		for (auto i{0}; i < Keys.Num(); i++)
+		{
+			const auto& Key{Keys[i]};
+
+			if (!FMath::IsNearlyEqual(Key.Value, Entry.ConstantValue, ConstantTolerance) ||
+			    (Key.InterpMode == RCIM_Cubic && (!FMath::IsNearlyZero(Key.ArriveTangent, ConstantTolerance) ||
+			                                      !FMath::IsNearlyZero(Key.LeaveTangent, ConstantTolerance))))
+			{
+				Entry.bConstant = false;
+				break;
+			}
+		}
+
+		Report.NumKeys += Entry.NumKeys;
+
+		if (Entry.bConstant)
+		{
+			Report.NumConstantCurves += 1;
+		}
+
+		if (!Entry.bKnown)
+		{
+			Report.NumUnknownCurves += 1;
+		}
+	}
+
+	return Report;
+}
+
+int32 UAlsCurveBudgetUtility::PruneSequence(UAnimSequence* Sequence, const FAlsCurveBudgetReport& Report, const int32 Flags)
+{
+	if (!ALS_ENSURE(IsValid(Sequence)) || !ALS_ENSURE(Report.SequenceName == Sequence->GetPathName()))
+	{
+		return 0;
+	}
+
+	const auto PruneFlags{static_cast<EAlsCurvePruneFlags>(Flags)};
+	auto NumPrunedCurves{0};
+
+	for (const auto& Entry : Report.Curves)
+	{
+		if (!UAnimationBlueprintLibrary::DoesCurveExist(Sequence, Entry.Name, ERawCurveTrackTypes::RCT_Float))
+		{
+			continue;
+		}
+
+		if ((!Entry.bKnown && EnumHasAnyFlags(PruneFlags, EAlsCurvePruneFlags::StripUnknownCurves)) ||
+		    (Entry.bConstant && FMath::IsNearlyZero(Entry.ConstantValue) &&
+		     EnumHasAnyFlags(PruneFlags, EAlsCurvePruneFlags::StripConstantZeroCurves)))
+		{
+			UAnimationBlueprintLibrary::RemoveCurve(Sequence, Entry.Name);
+			NumPrunedCurves += 1;
+			continue;
+		}
+
+		if (Entry.bConstant && Entry.NumKeys > 1 && EnumHasAnyFlags(PruneFlags, EAlsCurvePruneFlags::CollapseConstantCurves))
+		{
+			UAnimationBlueprintLibrary::RemoveCurve(Sequence, Entry.Name);
+			UAnimationBlueprintLibrary::AddCurve(Sequence, Entry.Name);
+			UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, Entry.Name, Sequence->GetTimeAtFrame(0), Entry.ConstantValue);
+			NumPrunedCurves += 1;
+		}
+	}
+
+	return NumPrunedCurves;
+}
+
+FString UAlsCurveBudgetUtility::ReportToString(const FAlsCurveBudgetReport& Report, const bool bVerbose)
+{
+	auto Result{
+		FString::Printf(TEXT("%s: %d curves, %d keys, %d constant, %d unknown."), *Report.SequenceName,
+		                Report.Curves.Num(), Report.NumKeys, Report.NumConstantCurves, Report.NumUnknownCurves)
+	};
+
+	if (!bVerbose)
+	{
+		return Result;
+	}
+
+	for (const auto& Entry : Report.Curves)
+	{
+		Result += FString::Printf(TEXT("\n\t%s: %d keys"), *Entry.Name.ToString(), Entry.NumKeys);
+
+		if (Entry.bConstant)
+		{
+			Result += FString::Printf(TEXT(", constant %.3f"), Entry.ConstantValue);
+		}
+
+		if (!Entry.bKnown)
+		{
+			Result += TEXT(", unknown");
+		}
+	}
+
+	return Result;
+}
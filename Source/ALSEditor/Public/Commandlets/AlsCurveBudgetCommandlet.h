@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "AlsCurveBudgetCommandlet.generated.h"
+
+// Scans animation sequences and reports their curve budget. Usage example:
+// UnrealEditor-Cmd.exe Project.uproject -run=AlsCurveBudget -Path=/Game/ALS -Verbose -Collapse -StripZero -StripUnknown
+// -KnownCurves=CurveA,CurveB -Tolerance=0.0001 -Save
+UCLASS()
+class ALSEDITOR_API UAlsCurveBudgetCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAlsCurveBudgetCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,33 @@
+﻿#pragma once
+
+#include "AnimationModifier.h"
+#include "Utility/AlsConstants.h"
+#include "AlsAnimationModifier_ConvertLayeringCurvesToAttributes.generated.h"
+
+// Converts layering curves to float animation attributes of the root bone. Used together
+// with the "Use Layering Attributes" option of the animation instance settings.
+UCLASS(DisplayName = "Als Convert Layering Curves To Attributes Animation Modifier")
+class ALSEDITOR_API UAlsAnimationModifier_ConvertLayeringCurvesToAttributes : public UAnimationModifier
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bRemoveCurves{true};
+
+	// Value of the attribute created for a layering curve that does not exist in the animation. Usually
+	// it is required because attributes are only blended by nodes in which they are present.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (InlineEditConditionToggle))
+	bool bCreateMissingAttributes{true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (EditCondition = "bCreateMissingAttributes"))
+	float MissingAttributeValue{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FName> CurveNames{UAlsConstants::LayeringCurveNames()};
+
+public:
+	virtual void OnApply_Implementation(UAnimSequence* Sequence) override;
+
+	virtual void OnRevert_Implementation(UAnimSequence* Sequence) override;
+};
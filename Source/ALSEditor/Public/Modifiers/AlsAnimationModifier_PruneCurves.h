@@ -0,0 +1,25 @@
+﻿#pragma once
+
+#include "AnimationModifier.h"
+#include "Utility/AlsCurveBudgetUtility.h"
+#include "AlsAnimationModifier_PruneCurves.generated.h"
+
+UCLASS(DisplayName = "Als Prune Curves Animation Modifier")
+class ALSEDITOR_API UAlsAnimationModifier_PruneCurves : public UAnimationModifier
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (Bitmask, BitmaskEnum = "EAlsCurvePruneFlags"))
+	int32 Flags{static_cast<int32>(EAlsCurvePruneFlags::CollapseConstantCurves)};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0))
+	float ConstantTolerance{0.0001f};
+
+	// Project specific curves that should be treated as known and never stripped.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FName> AdditionalKnownCurveNames;
+
+public:
+	virtual void OnApply_Implementation(UAnimSequence* Sequence) override;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "AnimGraphNode_Base.h"
+#include "Nodes/AlsAnimNode_FarLodBlend.h"
+#include "AlsAnimGraphNode_FarLodBlend.generated.h"
+
+UCLASS()
+class ALSEDITOR_API UAlsAnimGraphNode_FarLodBlend : public UAnimGraphNode_Base
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsAnimNode_FarLodBlend Node;
+
+public:
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+
+	virtual FText GetTooltipText() const override;
+
+	virtual FString GetNodeCategory() const override;
+};
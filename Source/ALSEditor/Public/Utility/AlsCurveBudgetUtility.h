@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "AlsCurveBudgetUtility.generated.h"
+
+class UAnimSequence;
+
+USTRUCT(BlueprintType)
+struct ALSEDITOR_API FAlsCurveBudgetEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 NumKeys{0};
+
+	// Curve is known if it is read by ALS (animation instance, camera) or is listed as an additional known curve.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bKnown{false};
+
+	// Curve is constant if all of its keys have the same value within tolerance and all of its cubic keys have flat tangents.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bConstant{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bConstant"))
+	float ConstantValue{0.0f};
+};
+
+USTRUCT(BlueprintType)
+struct ALSEDITOR_API FAlsCurveBudgetReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FString SequenceName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 NumKeys{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 NumConstantCurves{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 NumUnknownCurves{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FAlsCurveBudgetEntry> Curves;
+};
+
+UENUM(BlueprintType, Meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EAlsCurvePruneFlags : uint8
+{
+	None = 0 UMETA(Hidden),
+	// Replace constant curves that have more than one key with a single key.
+	CollapseConstantCurves = 1 << 0,
+	// Remove constant curves whose value is zero. A missing curve is read as zero by ALS, but keep in mind
+	// that it will no longer override the value of the same curve in poses blended with this sequence.
+	StripConstantZeroCurves = 1 << 1,
+	// Remove curves that are not read by ALS and are not listed as additional known curves.
+	StripUnknownCurves = 1 << 2
+};
+
+ENUM_CLASS_FLAGS(EAlsCurvePruneFlags)
+
+UCLASS()
+class ALSEDITOR_API UAlsCurveBudgetUtility : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Returns names of all curves that are read by ALS at runtime.
+	UFUNCTION(BlueprintPure, Category = "ALS|Als Curve Budget Utility")
+	static const TArray<FName>& GetKnownCurveNames();
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Curve Budget Utility", Meta = (AutoCreateRefTerm = "AdditionalKnownCurveNames"))
+	static FAlsCurveBudgetReport AnalyzeSequence(const UAnimSequence* Sequence, const TArray<FName>& AdditionalKnownCurveNames,
+	                                             float ConstantTolerance = 0.0001f);
+
+	// Returns the number of curves that were removed or collapsed.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Curve Budget Utility")
+	static int32 PruneSequence(UAnimSequence* Sequence, const FAlsCurveBudgetReport& Report,
+	                           UPARAM(Meta = (Bitmask, BitmaskEnum = "EAlsCurvePruneFlags")) int32 Flags);
+
+	static FString ReportToString(const FAlsCurveBudgetReport& Report, bool bVerbose);
+};
@@ -8,7 +8,8 @@ public class ALSExtras : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new[]
 		{
-			"Core", "CoreUObject", "Engine", "GameplayTags", "EnhancedInput", "AIModule", "ALS", "ALSCamera"
+			"Core", "CoreUObject", "Engine", "GameplayTags", "EnhancedInput", "AIModule", "NavigationSystem", "Navmesh",
+			"Json", "JsonUtilities", "ALS", "ALSCamera"
 		});
 	}
 }
\ No newline at end of file
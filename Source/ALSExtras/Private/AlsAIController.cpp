@@ -1,6 +1,11 @@
 #include "AlsAIController.h"
 
-AAlsAIController::AAlsAIController()
+#include "AlsCharacter.h"
+#include "AlsPathFollowingComponent.h"
+
+AAlsAIController::AAlsAIController(const FObjectInitializer& ObjectInitializer) : Super{
+	ObjectInitializer.SetDefaultSubobjectClass<UAlsPathFollowingComponent>(TEXT("PathFollowingComponent"))
+}
 {
 	bAttachToPawn = true;
 }
@@ -12,6 +17,36 @@ void AAlsAIController::OnPossess(APawn* NewPawn)
 	RunBehaviorTree(BehaviorTree);
 }
 
+void AAlsAIController::UpdateControlRotation(const float DeltaTime, const bool bUpdatePawn)
+{
+	FocusUpdateTimeRemaining -= DeltaTime;
+	if (FocusUpdateTimeRemaining > 0.0f)
+	{
+		return;
+	}
+
+	FocusUpdateTimeRemaining = FocusUpdateInterval;
+
+	Super::UpdateControlRotation(DeltaTime, bUpdatePawn);
+
+	auto* Character{Cast<AAlsCharacter>(GetPawn())};
+	if (IsValid(Character))
+	{
+		const auto FocalPoint{GetFocalPoint()};
+
+		FAlsViewFocusTarget FocusTarget;
+		FocusTarget.bValid = FAISystem::IsValidLocation(FocalPoint);
+
+		if (FocusTarget.bValid)
+		{
+			FocusTarget.Actor = GetFocusActor();
+			FocusTarget.Location = FocalPoint;
+		}
+
+		Character->SetViewFocusTarget(FocusTarget);
+	}
+}
+
 FVector AAlsAIController::GetFocalPointOnActor(const AActor* Actor) const
 {
 	const auto* FocusedPawn{Cast<APawn>(Actor)};
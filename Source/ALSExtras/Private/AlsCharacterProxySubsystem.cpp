@@ -0,0 +1,355 @@
+#include "AlsCharacterProxySubsystem.h"
+
+#include "AIController.h"
+#include "AlsCharacter.h"
+#include "BrainComponent.h"
+#include "NavigationSystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+TStatId UAlsCharacterProxySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsCharacterProxySubsystem, STATGROUP_Als);
+}
+
+void UAlsCharacterProxySubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterProxySubsystem::Tick()"), STAT_UAlsCharacterProxySubsystem_Tick, STATGROUP_Als)
+
+	Super::Tick(DeltaTime);
+
+	for (auto i{Proxies.Num() - 1}; i >= 0; i--)
+	{
+		auto& Proxy{Proxies[i]};
+
+		// The dormant character may have been destroyed by the game in the meantime.
+
+		if (!IsValid(Proxy.Character))
+		{
+			RemoveProxyInstance(Proxy);
+			Proxies.RemoveAtSwap(i, 1, false);
+			continue;
+		}
+
+		MoveProxy(Proxy, DeltaTime);
+
+		if (IsNearAnyPlayer(Proxy.Location, Proxy.Settings.PromotionDistance))
+		{
+			PromoteProxy(i);
+		}
+	}
+
+	RefreshInstancedMeshes();
+}
+
+void UAlsCharacterProxySubsystem::MoveProxy(FAlsCharacterProxy& Proxy, const float DeltaTime) const
+{
+	if (Proxy.Velocity.IsNearlyZero())
+	{
+		return;
+	}
+
+	const auto NavigationLocation{Proxy.Location - Proxy.NavigationLocationOffset};
+	auto TargetLocation{NavigationLocation + Proxy.Velocity * DeltaTime};
+	auto bPathFinished{false};
+
+	if (Proxy.PathPoints.IsValidIndex(Proxy.NextPathPointIndex))
+	{
+		// Head to the next path point, and don't overshoot it, so that the proxy doesn't cut corners.
+
+		const auto& PathPoint{Proxy.PathPoints[Proxy.NextPathPointIndex]};
+		const auto Speed{Proxy.Velocity.Size()};
+		const auto Direction{(PathPoint - NavigationLocation).GetSafeNormal()};
+
+		if (FVector::DistSquared(NavigationLocation, PathPoint) <= FMath::Square(Speed * DeltaTime))
+		{
+			TargetLocation = PathPoint;
+
+			Proxy.NextPathPointIndex += 1;
+			bPathFinished = !Proxy.PathPoints.IsValidIndex(Proxy.NextPathPointIndex);
+		}
+		else if (!Direction.IsNearlyZero())
+		{
+			Proxy.Velocity = Direction * Speed;
+			Proxy.Rotation.Yaw = Direction.Rotation().Yaw;
+
+			TargetLocation = NavigationLocation + Proxy.Velocity * DeltaTime;
+		}
+	}
+
+	// Proxies don't have any collision, so stop them where the navigation mesh is blocked and keep them on it.
+
+	FVector HitLocation;
+	if (UNavigationSystemV1::NavigationRaycast(GetWorld(), NavigationLocation, TargetLocation, HitLocation))
+	{
+		TargetLocation = HitLocation;
+		bPathFinished = true;
+	}
+
+	const auto* NavigationSystem{FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld())};
+
+	FNavLocation ProjectedLocation;
+	if (!IsValid(NavigationSystem) || !NavigationSystem->ProjectPointToNavigation(TargetLocation, ProjectedLocation))
+	{
+		Proxy.Velocity = FVector::ZeroVector;
+		return;
+	}
+
+	Proxy.Location = ProjectedLocation.Location + Proxy.NavigationLocationOffset;
+
+	if (bPathFinished)
+	{
+		Proxy.Velocity = FVector::ZeroVector;
+	}
+}
+
+void UAlsCharacterProxySubsystem::RefreshInstancedMeshes()
+{
+	// Instances of each mesh always belong to proxies, so all of them can be updated with a
+	// single batch, which also marks the render state of the instanced mesh dirty only once.
+
+	TArray<FTransform> InstanceTransforms;
+
+	for (const auto& InstancedMesh : InstancedMeshes)
+	{
+		if (!IsValid(InstancedMesh.Value) || InstancedMesh.Value->GetInstanceCount() <= 0)
+		{
+			continue;
+		}
+
+		InstanceTransforms.Reset();
+		InstanceTransforms.SetNum(InstancedMesh.Value->GetInstanceCount());
+
+		for (const auto& Proxy : Proxies)
+		{
+			if (InstanceTransforms.IsValidIndex(Proxy.InstanceIndex) && Proxy.Settings.Mesh == InstancedMesh.Key)
+			{
+				InstanceTransforms[Proxy.InstanceIndex] = FTransform{Proxy.Rotation, Proxy.Location};
+			}
+		}
+
+		InstancedMesh.Value->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, true);
+	}
+}
+
+bool UAlsCharacterProxySubsystem::IsNearAnyPlayer(const FVector& Location, const float Distance) const
+{
+	const auto DistanceSquared{FMath::Square(Distance)};
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+		if (!IsValid(PlayerController))
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		if (FVector::DistSquared(ViewLocation, Location) < DistanceSquared)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UAlsCharacterProxySubsystem::DemoteCharacter(AAlsCharacter* Character, const FAlsCharacterProxySettings& Settings)
+{
+	if (!ALS_ENSURE(IsValid(Character)) || !Character->HasAuthority() ||
+	    Proxies.ContainsByPredicate([Character](const FAlsCharacterProxy& Proxy) { return Proxy.Character == Character; }))
+	{
+		return false;
+	}
+
+	auto* CharacterMovement{Character->GetCharacterMovement()};
+	auto& Proxy{Proxies.AddDefaulted_GetRef()};
+
+	Proxy.Character = Character;
+	Proxy.Settings = Settings;
+	Proxy.Location = Character->GetActorLocation();
+	Proxy.Rotation = Character->GetActorRotation();
+	Proxy.Velocity = CharacterMovement->Velocity;
+	Proxy.NavigationLocationOffset = Proxy.Location - Character->GetNavAgentLocation();
+
+	// Proxies are kept on the navigation mesh, so they never move vertically on their own.
+
+	Proxy.Velocity.Z = 0.0f;
+
+	if (IsValid(Settings.Mesh) && !IsNetMode(NM_DedicatedServer))
+	{
+		auto* InstancedMesh{GetOrCreateInstancedMesh(Settings.Mesh)};
+		if (IsValid(InstancedMesh))
+		{
+			Proxy.InstanceIndex = InstancedMesh->AddInstance(FTransform{Proxy.Rotation, Proxy.Location}, true);
+		}
+	}
+
+	auto* Controller{Cast<AAIController>(Character->GetController())};
+	if (IsValid(Controller))
+	{
+		// Let the proxy continue along the remaining part of the current path.
+
+		const auto* PathFollowing{Controller->GetPathFollowingComponent()};
+		if (IsValid(PathFollowing) && PathFollowing->GetStatus() == EPathFollowingStatus::Moving && PathFollowing->GetPath().IsValid())
+		{
+			const auto& PathPoints{PathFollowing->GetPath()->GetPathPoints()};
+
+			for (auto i{FMath::Max(0, PathFollowing->GetNextPathIndex())}; i < PathPoints.Num(); i++)
+			{
+				Proxy.PathPoints.Add(PathPoints[i].Location);
+			}
+		}
+
+		// Pause the controller instead of destroying it, so that the behavior tree, blackboard,
+		// and path following keep their state and continue from it once the character wakes up.
+
+		Controller->PauseMove(Controller->GetCurrentMoveRequestID());
+
+		if (IsValid(Controller->BrainComponent))
+		{
+			Controller->BrainComponent->PauseLogic(TEXT("Character demoted to proxy."));
+		}
+	}
+
+	// Make the character dormant. It's not moved while dormant, since the proxy is moved in its place.
+
+	CharacterMovement->StopMovementImmediately();
+
+	Proxy.bActorTickWasEnabled = Character->IsActorTickEnabled();
+	Character->SetActorTickEnabled(false);
+
+	for (auto* Component : Character->GetComponents())
+	{
+		if (IsValid(Component) && Component->IsComponentTickEnabled())
+		{
+			Component->SetComponentTickEnabled(false);
+			Proxy.PausedComponents.Add(Component);
+		}
+	}
+
+	Character->SetActorHiddenInGame(true);
+	Character->SetActorEnableCollision(false);
+
+	Proxy.bMeshWasRegistered = Character->GetMesh()->IsRegistered();
+	Character->GetMesh()->UnregisterComponent();
+
+	return true;
+}
+
+AAlsCharacter* UAlsCharacterProxySubsystem::PromoteProxy(const int32 ProxyIndex)
+{
+	if (!ALS_ENSURE(Proxies.IsValidIndex(ProxyIndex)))
+	{
+		return nullptr;
+	}
+
+	const auto Proxy{Proxies[ProxyIndex]};
+
+	RemoveProxyInstance(Proxy);
+	Proxies.RemoveAtSwap(ProxyIndex, 1, false);
+
+	auto* Character{Proxy.Character.Get()};
+	if (!IsValid(Character))
+	{
+		return nullptr;
+	}
+
+	if (Proxy.bMeshWasRegistered)
+	{
+		Character->GetMesh()->RegisterComponent();
+	}
+
+	Character->SetActorEnableCollision(true);
+	Character->TeleportTo(Proxy.Location, Proxy.Rotation, false, true);
+	Character->SetActorHiddenInGame(false);
+
+	Character->SetActorTickEnabled(Proxy.bActorTickWasEnabled);
+
+	for (auto* Component : Proxy.PausedComponents)
+	{
+		if (IsValid(Component))
+		{
+			Component->SetComponentTickEnabled(true);
+		}
+	}
+
+	Character->GetCharacterMovement()->Velocity = Proxy.Velocity;
+
+	auto* Controller{Cast<AAIController>(Character->GetController())};
+	if (IsValid(Controller))
+	{
+		if (IsValid(Controller->BrainComponent))
+		{
+			Controller->BrainComponent->ResumeLogic(TEXT("Proxy promoted to character."));
+		}
+
+		// The path following component checks whether the character is still on its path and finds the current path segment.
+
+		Controller->ResumeMove(Controller->GetCurrentMoveRequestID());
+	}
+
+	return Character;
+}
+
+UInstancedStaticMeshComponent* UAlsCharacterProxySubsystem::GetOrCreateInstancedMesh(UStaticMesh* Mesh)
+{
+	auto& InstancedMesh{InstancedMeshes.FindOrAdd(Mesh)};
+	if (IsValid(InstancedMesh))
+	{
+		return InstancedMesh;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+
+	auto* Actor{GetWorld()->SpawnActor<AActor>(SpawnParameters)};
+	if (!IsValid(Actor))
+	{
+		return nullptr;
+	}
+
+	InstancedMesh = NewObject<UInstancedStaticMeshComponent>(Actor);
+	InstancedMesh->SetStaticMesh(Mesh);
+	InstancedMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	InstancedMesh->SetCanEverAffectNavigation(false);
+	InstancedMesh->SetMobility(EComponentMobility::Movable);
+
+	Actor->SetRootComponent(InstancedMesh);
+	InstancedMesh->RegisterComponent();
+
+	return InstancedMesh;
+}
+
+void UAlsCharacterProxySubsystem::RemoveProxyInstance(const FAlsCharacterProxy& Proxy)
+{
+	if (Proxy.InstanceIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	auto* InstancedMesh{InstancedMeshes.FindRef(Proxy.Settings.Mesh)};
+	if (!IsValid(InstancedMesh))
+	{
+		return;
+	}
+
+	InstancedMesh->RemoveInstance(Proxy.InstanceIndex);
+
+	// Removing an instance shifts the indices of all subsequent instances of the same mesh.
+
+	for (auto& OtherProxy : Proxies)
+	{
+		if (OtherProxy.InstanceIndex > Proxy.InstanceIndex && OtherProxy.Settings.Mesh == Proxy.Settings.Mesh)
+		{
+			OtherProxy.InstanceIndex -= 1;
+		}
+	}
+}
@@ -0,0 +1,243 @@
+#include "AlsCrowdSharingComponent.h"
+
+#include "AlsAnimationInstance.h"
+#include "AlsCharacter.h"
+#include "AlsCharacterProxySubsystem.h"
+#include "AlsCrowdSharingSettings.h"
+#include "AlsCrowdSharingSubsystem.h"
+#include "Animation/AnimInstance.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Utility/AlsConstants.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+UAlsCrowdSharingComponent::UAlsCrowdSharingComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+}
+
+void UAlsCrowdSharingComponent::OnRegister()
+{
+	Character = Cast<AAlsCharacter>(GetOwner());
+
+	Super::OnRegister();
+}
+
+void UAlsCrowdSharingComponent::BeginPlay()
+{
+	ALS_ENSURE(IsValid(Settings));
+	ALS_ENSURE(IsValid(Character));
+
+	Super::BeginPlay();
+
+	// Nothing is rendered on a dedicated server, so the full animation instance is always used there.
+
+	if (!IsValid(Settings) || (IsNetMode(NM_DedicatedServer) && !Settings->Proxy.bEnabled))
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	SetComponentTickInterval(Settings->UpdateInterval);
+
+	// Locomotion actions play montages, which require the individual animation instance, so don't wait for the next tick.
+
+	if (IsValid(Character))
+	{
+		Character->LocomotionActionChanged.AddUObject(this, &ThisClass::Character_OnLocomotionActionChanged);
+	}
+}
+
+void UAlsCrowdSharingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (IsValid(Character))
+	{
+		Character->LocomotionActionChanged.RemoveAll(this);
+	}
+
+	StopSharing();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAlsCrowdSharingComponent::TickComponent(const float DeltaTime, const ELevelTick TickType,
+                                              FActorComponentTickFunction* ThisTickFunction)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCrowdSharingComponent::TickComponent()"),
+	                            STAT_UAlsCrowdSharingComponent_TickComponent, STATGROUP_Als)
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!IsValid(Settings) || !IsValid(Character))
+	{
+		return;
+	}
+
+	if (ShouldBecomeProxy())
+	{
+		auto* Subsystem{GetWorld()->GetSubsystem<UAlsCharacterProxySubsystem>()};
+		if (IsValid(Subsystem) && Subsystem->DemoteCharacter(Character, Settings->Proxy))
+		{
+			return;
+		}
+	}
+
+	if (IsNetMode(NM_DedicatedServer))
+	{
+		return;
+	}
+
+	const auto StateIndex{ShouldBeIndividual() ? INDEX_NONE : Settings->FindStateIndex(*Character)};
+	if (StateIndex == SharedStateIndex)
+	{
+		return;
+	}
+
+	if (StateIndex == INDEX_NONE)
+	{
+		StopSharing();
+		return;
+	}
+
+	// The character applies some animation curves to its rotation. These curves are no longer updated while the
+	// pose is shared, so wait until they are no longer relevant to prevent the character from rotating endlessly.
+
+	const auto* AnimationInstance{Character->GetMesh()->GetAnimInstance()};
+	if (!IsShared() && IsValid(AnimationInstance) &&
+	    (!FMath::IsNearlyZero(AnimationInstance->GetCurveValue(UAlsConstants::RotationYawSpeedCurveName())) ||
+	     !FMath::IsNearlyZero(AnimationInstance->GetCurveValue(UAlsConstants::RotationYawOffsetCurveName()))))
+	{
+		return;
+	}
+
+	StartSharing(StateIndex);
+}
+
+void UAlsCrowdSharingComponent::SetIndividualRequested(const bool bNewIndividualRequested)
+{
+	bIndividualRequested = bNewIndividualRequested;
+
+	if (bIndividualRequested)
+	{
+		StopSharing();
+	}
+}
+
+void UAlsCrowdSharingComponent::Character_OnLocomotionActionChanged(const FGameplayTag& PreviousLocomotionAction)
+{
+	if (Character->GetLocomotionAction().IsValid())
+	{
+		StopSharing();
+	}
+}
+
+bool UAlsCrowdSharingComponent::ShouldBeIndividual() const
+{
+	if (bIndividualRequested || Character->GetLocomotionAction().IsValid() || Character->IsLocallyControlled())
+	{
+		return true;
+	}
+
+	const auto DistanceThreshold{IsShared() ? Settings->IndividualDistance : Settings->SharedDistance};
+	const auto DistanceThresholdSquared{FMath::Square(DistanceThreshold)};
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+
+		if (IsValid(PlayerController) && PlayerController->IsLocalController() && IsValid(PlayerController->PlayerCameraManager) &&
+		    FVector::DistSquared(PlayerController->PlayerCameraManager->GetCameraLocation(),
+		                         Character->GetActorLocation()) < DistanceThresholdSquared)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UAlsCrowdSharingComponent::ShouldBecomeProxy() const
+{
+	if (!Settings->Proxy.bEnabled || !Character->HasAuthority() || Character->IsPlayerControlled() || bIndividualRequested ||
+	    Character->GetLocomotionAction().IsValid() || Character->GetLocomotionMode() != AlsLocomotionModeTags::Grounded)
+	{
+		return false;
+	}
+
+	const auto* Subsystem{GetWorld()->GetSubsystem<UAlsCharacterProxySubsystem>()};
+
+	return IsValid(Subsystem) && !Subsystem->IsNearAnyPlayer(Character->GetActorLocation(), Settings->Proxy.DemotionDistance);
+}
+
+void UAlsCrowdSharingComponent::StartSharing(const int32 StateIndex)
+{
+	auto* Mesh{Character->GetMesh()};
+	auto* Subsystem{GetWorld()->GetSubsystem<UAlsCrowdSharingSubsystem>()};
+
+	auto* Leader{
+		IsValid(Subsystem)
+			? Subsystem->GetOrCreateLeader(Mesh->SkeletalMesh, Settings->States[StateIndex].Animation)
+			: nullptr
+	};
+
+	if (!IsValid(Leader))
+	{
+		StopSharing();
+		return;
+	}
+
+	SharedStateIndex = StateIndex;
+
+	// Stop ticking the mesh so that the animation instance is no longer updated and evaluated.
+
+	Mesh->SetMasterPoseComponent(Leader, true);
+	Mesh->SetComponentTickEnabled(false);
+
+	// The mesh rotation is synchronized with the character rotation only by the animation instance, which
+	// is no longer updated, so temporarily attach the mesh rotation to the character to keep them in sync.
+
+	bMeshUsedAbsoluteRotation = Mesh->IsUsingAbsoluteRotation();
+	if (bMeshUsedAbsoluteRotation)
+	{
+		Mesh->SetUsingAbsoluteRotation(false);
+		Mesh->SetRelativeRotation(Character->GetBaseRotationOffset());
+	}
+}
+
+void UAlsCrowdSharingComponent::StopSharing()
+{
+	if (!IsShared())
+	{
+		return;
+	}
+
+	SharedStateIndex = INDEX_NONE;
+
+	if (!IsValid(Character))
+	{
+		return;
+	}
+
+	auto* Mesh{Character->GetMesh()};
+
+	Mesh->SetMasterPoseComponent(nullptr);
+	Mesh->SetComponentTickEnabled(true);
+
+	if (bMeshUsedAbsoluteRotation)
+	{
+		bMeshUsedAbsoluteRotation = false;
+
+		Mesh->SetUsingAbsoluteRotation(true);
+		Mesh->SetWorldRotation(Character->GetActorQuat() * Character->GetBaseRotationOffset());
+	}
+
+	// The state of the animation instance is outdated, so reinitialize it on the next update.
+
+	auto* AnimationInstance{Cast<UAlsAnimationInstance>(Mesh->GetAnimInstance())};
+	if (IsValid(AnimationInstance))
+	{
+		AnimationInstance->MarkPendingUpdate();
+	}
+}
@@ -0,0 +1,22 @@
+#include "AlsCrowdSharingSettings.h"
+
+#include "AlsCharacter.h"
+
+int32 UAlsCrowdSharingSettings::FindStateIndex(const AAlsCharacter& Character) const
+{
+	for (auto i{0}; i < States.Num(); i++)
+	{
+		const auto& State{States[i]};
+
+		if (IsValid(State.Animation) &&
+		    (!State.LocomotionMode.IsValid() || State.LocomotionMode == Character.GetLocomotionMode()) &&
+		    (!State.Stance.IsValid() || State.Stance == Character.GetStance()) &&
+		    (!State.Gait.IsValid() || State.Gait == Character.GetGait()) &&
+		    (!State.OverlayMode.IsValid() || State.OverlayMode == Character.GetOverlayMode()))
+		{
+			return i;
+		}
+	}
+
+	return INDEX_NONE;
+}
@@ -0,0 +1,64 @@
+#include "AlsCrowdSharingSubsystem.h"
+
+#include "Animation/SkeletalMeshActor.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Utility/AlsMacros.h"
+
+void UAlsCrowdSharingSubsystem::Deinitialize()
+{
+	for (const auto& Leader : Leaders)
+	{
+		if (IsValid(Leader.Component))
+		{
+			Leader.Component->GetOwner()->Destroy();
+		}
+	}
+
+	Leaders.Reset();
+
+	Super::Deinitialize();
+}
+
+USkeletalMeshComponent* UAlsCrowdSharingSubsystem::GetOrCreateLeader(USkeletalMesh* Mesh, UAnimSequenceBase* Animation)
+{
+	if (!ALS_ENSURE(IsValid(Mesh)) || !ALS_ENSURE(IsValid(Animation)))
+	{
+		return nullptr;
+	}
+
+	for (const auto& Leader : Leaders)
+	{
+		if (Leader.Mesh == Mesh && Leader.Animation == Animation && IsValid(Leader.Component))
+		{
+			return Leader.Component;
+		}
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+
+	auto* LeaderActor{GetWorld()->SpawnActor<ASkeletalMeshActor>(SpawnParameters)};
+	if (!IsValid(LeaderActor))
+	{
+		return nullptr;
+	}
+
+	LeaderActor->SetReplicates(false);
+	LeaderActor->SetActorHiddenInGame(true);
+
+	// The leader is never rendered, so its pose must be refreshed regardless of visibility.
+
+	auto* LeaderComponent{LeaderActor->GetSkeletalMeshComponent()};
+	LeaderComponent->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+	LeaderComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	LeaderComponent->SetSkeletalMesh(Mesh);
+	LeaderComponent->PlayAnimation(Animation, true);
+
+	auto& Leader{Leaders.AddDefaulted_GetRef()};
+	Leader.Mesh = Mesh;
+	Leader.Animation = Animation;
+	Leader.Component = LeaderComponent;
+
+	return LeaderComponent;
+}
@@ -0,0 +1,156 @@
+#include "AlsMantlingNavLinkGenerator.h"
+
+#include "AlsCharacter.h"
+#include "AlsNavArea_Mantling.h"
+#include "NavigationSystem.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsMath.h"
+
+AAlsMantlingNavLinkGenerator::AAlsMantlingNavLinkGenerator()
+{
+	Bounds = CreateDefaultSubobject<UBoxComponent>(TEXT("Bounds"));
+	Bounds->SetupAttachment(RootComponent);
+	Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Bounds->SetCanEverAffectNavigation(false);
+	Bounds->InitBoxExtent({500.0f, 500.0f, 250.0f});
+
+	PointLinks.Reset();
+}
+
+void AAlsMantlingNavLinkGenerator::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bGenerateLinksOnBeginPlay)
+	{
+		GenerateLinks();
+	}
+}
+
+void AAlsMantlingNavLinkGenerator::GenerateLinks()
+{
+	Modify();
+	PointLinks.Reset();
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	SpawnParameters.bTemporaryEditorActor = true;
+
+	auto* Character{
+		ALS_ENSURE(IsValid(CharacterClass))
+			? GetWorld()->SpawnActor<AAlsCharacter>(CharacterClass, GetActorTransform(), SpawnParameters)
+			: nullptr
+	};
+
+	if (IsValid(Character) && ALS_ENSURE(IsValid(Character->GetSettings())))
+	{
+		Character->SetActorEnableCollision(false);
+
+		const auto* Capsule{Character->GetCapsuleComponent()};
+		const auto* CharacterMovement{Character->GetCharacterMovement()};
+		const auto& TraceSettings{Character->GetSettings()->Mantling.GroundedTrace};
+
+		const auto CapsuleHalfHeight{Capsule->GetScaledCapsuleHalfHeight()};
+		const auto CapsuleShape{Capsule->GetCollisionShape()};
+
+		const auto& BoundsTransform{Bounds->GetComponentTransform()};
+		const auto BoundsExtent{Bounds->GetUnscaledBoxExtent()};
+
+		static const FName GroundTraceTag{__FUNCTION__ TEXT(" (Ground Trace)")};
+		static const FName FreeSpaceTraceTag{__FUNCTION__ TEXT(" (Free Space Overlap)")};
+
+		FCollisionQueryParams QueryParameters{GroundTraceTag, false, Character};
+		FCollisionResponseParams ResponseParameters;
+
+		Capsule->InitSweepCollisionParams(QueryParameters, ResponseParameters);
+
+		for (auto X{-BoundsExtent.X}; X <= BoundsExtent.X; X += SampleSpacing)
+		{
+			for (auto Y{-BoundsExtent.Y}; Y <= BoundsExtent.Y; Y += SampleSpacing)
+			{
+				// Find a walkable floor below the sample location.
+
+				const auto GroundTraceStart{BoundsTransform.TransformPosition({X, Y, BoundsExtent.Z})};
+				const auto GroundTraceEnd{BoundsTransform.TransformPosition({X, Y, -BoundsExtent.Z})};
+
+				FHitResult GroundHit;
+				if (!GetWorld()->LineTraceSingleByChannel(GroundHit, GroundTraceStart, GroundTraceEnd, Capsule->GetCollisionObjectType(),
+				                                          QueryParameters, ResponseParameters) ||
+				    !CharacterMovement->IsWalkable(GroundHit))
+				{
+					continue;
+				}
+
+				const FVector CapsuleLocation{
+					GroundHit.ImpactPoint.X,
+					GroundHit.ImpactPoint.Y,
+					GroundHit.ImpactPoint.Z + CapsuleHalfHeight + UCharacterMovementComponent::MIN_FLOOR_DIST
+				};
+
+				if (GetWorld()->OverlapBlockingTestByChannel(CapsuleLocation, FQuat::Identity, Capsule->GetCollisionObjectType(),
+				                                             CapsuleShape, {FreeSpaceTraceTag, false, Character}, ResponseParameters))
+				{
+					continue;
+				}
+
+				Character->SetActorLocation(CapsuleLocation, false, nullptr, ETeleportType::TeleportPhysics);
+
+				for (auto i{0}; i < DirectionsCount; i++)
+				{
+					const auto ForwardTraceDirection{UAlsMath::AngleToDirectionXY(360.0f * static_cast<float>(i) / DirectionsCount)};
+
+					FAlsMantlingParameters Parameters;
+					FVector TargetLocation;
+
+					// Links can't follow moving objects, so ignore ledges on them.
+
+					if (Character->TraceMantlingTarget(TraceSettings, ForwardTraceDirection, Parameters, TargetLocation) &&
+					    Parameters.TargetPrimitive.IsValid() && Parameters.TargetPrimitive->Mobility != EComponentMobility::Movable)
+					{
+						AddLink(GroundHit.ImpactPoint, TargetLocation);
+					}
+				}
+			}
+		}
+	}
+
+	if (IsValid(Character))
+	{
+		Character->Destroy();
+	}
+
+	UE_LOG(LogAls, Log, __FUNCTION__ TEXT(": Generated %d mantling navigation links for %s."), PointLinks.Num(), *GetName());
+
+	UNavigationSystemV1::UpdateActorInNavOctree(*this);
+}
+
+void AAlsMantlingNavLinkGenerator::AddLink(const FVector& StartLocation, const FVector& TargetLocation)
+{
+	const auto& ActorTransform{GetActorTransform()};
+
+	const auto LinkStart{ActorTransform.InverseTransformPosition(StartLocation)};
+	const auto LinkEnd{ActorTransform.InverseTransformPosition(TargetLocation)};
+
+	const auto MinLinkSpacingSquared{FMath::Square(MinLinkSpacing)};
+
+	for (const auto& Link : PointLinks)
+	{
+		if (FVector::DistSquared(Link.Left, LinkStart) < MinLinkSpacingSquared &&
+		    FVector::DistSquared(Link.Right, LinkEnd) < MinLinkSpacingSquared)
+		{
+			return;
+		}
+	}
+
+	auto& Link{PointLinks.AddDefaulted_GetRef()};
+	Link.Left = LinkStart;
+	Link.Right = LinkEnd;
+	Link.Direction = ENavLinkDirection::LeftToRight;
+	Link.SetAreaClass(UAlsNavArea_Mantling::StaticClass());
+}
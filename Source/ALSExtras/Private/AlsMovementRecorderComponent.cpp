@@ -0,0 +1,380 @@
+#include "AlsMovementRecorderComponent.h"
+
+#include "AlsCharacter.h"
+#include "JsonObjectConverter.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "Misc/FileHelper.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+UAlsMovementRecorderComponent::UAlsMovementRecorderComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+}
+
+void UAlsMovementRecorderComponent::OnRegister()
+{
+	Character = Cast<AAlsCharacter>(GetOwner());
+
+	Super::OnRegister();
+}
+
+void UAlsMovementRecorderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (IsRecording())
+	{
+		StopRecording();
+	}
+
+	if (IsReplaying())
+	{
+		StopReplay();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAlsMovementRecorderComponent::TickComponent(const float DeltaTime, const ELevelTick TickType,
+                                                  FActorComponentTickFunction* ThisTickFunction)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsMovementRecorderComponent::TickComponent()"),
+	                            STAT_UAlsMovementRecorderComponent_TickComponent, STATGROUP_Als)
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!IsValid(Character))
+	{
+		return;
+	}
+
+	if (IsRecording())
+	{
+		RecordFrame(DeltaTime);
+	}
+	else if (IsReplaying())
+	{
+		ReplayFrame(DeltaTime);
+	}
+}
+
+void UAlsMovementRecorderComponent::StartRecording()
+{
+	if (!ALS_ENSURE(IsValid(Character)) || !ALS_ENSURE(Character->IsLocallyControlled()) || IsRecording() || IsReplaying())
+	{
+		return;
+	}
+
+	// Locomotion actions can't be restored at the start of the replay, so the recording must start without them.
+
+	if (Character->GetLocomotionAction().IsValid())
+	{
+		UE_LOG(LogAls, Warning, __FUNCTION__ TEXT(": Can't start recording while the %s locomotion action is active."),
+		       *Character->GetLocomotionAction().ToString());
+		return;
+	}
+
+	bRecording = true;
+
+	const auto* CharacterMovement{Character->GetCharacterMovement()};
+
+	Recording.Map = UWorld::RemovePIEPrefix(GetWorld()->GetOutermost()->GetName());
+	Recording.StartLocation = Character->GetActorLocation();
+	Recording.StartRotation = Character->GetActorRotation();
+	Recording.StartVelocity = CharacterMovement->Velocity;
+	Recording.StartMovementMode = CharacterMovement->MovementMode;
+	Recording.StartCustomMovementMode = CharacterMovement->CustomMovementMode;
+	Recording.StartDesiredRotationMode = Character->GetDesiredRotationMode();
+	Recording.StartDesiredStance = Character->GetDesiredStance();
+	Recording.StartDesiredGait = Character->GetDesiredGait();
+	Recording.bStartDesiredAiming = Character->IsDesiredAiming();
+	Recording.StartLocomotionMode = Character->GetLocomotionMode();
+	Recording.StartRotationMode = Character->GetRotationMode();
+	Recording.StartStance = Character->GetStance();
+	Recording.StartGait = Character->GetGait();
+	Recording.Frames.Reset();
+
+	PreviousJumpCount = Character->JumpCurrentCount;
+	PreviousLocomotionMode = Character->GetLocomotionMode();
+	PreviousLocomotionAction = Character->GetLocomotionAction();
+
+	// Record the frame after the character and its movement have been updated.
+
+	AddTickPrerequisiteActor(Character);
+	AddTickPrerequisiteComponent(Character->GetCharacterMovement());
+
+	SetComponentTickEnabled(true);
+}
+
+FAlsMovementRecording UAlsMovementRecorderComponent::StopRecording()
+{
+	if (!IsRecording())
+	{
+		return {};
+	}
+
+	bRecording = false;
+
+	RemoveTickPrerequisiteActor(Character);
+	RemoveTickPrerequisiteComponent(Character->GetCharacterMovement());
+
+	SetComponentTickEnabled(false);
+
+	return MoveTemp(Recording);
+}
+
+void UAlsMovementRecorderComponent::StartReplay(const FAlsMovementRecording& NewRecording)
+{
+	if (!ALS_ENSURE(IsValid(Character)) || !ALS_ENSURE(Character->IsLocallyControlled()) || IsRecording() || IsReplaying())
+	{
+		return;
+	}
+
+	if (Character->GetLocomotionAction().IsValid())
+	{
+		UE_LOG(LogAls, Warning, __FUNCTION__ TEXT(": Can't start replay while the %s locomotion action is active."),
+		       *Character->GetLocomotionAction().ToString());
+		return;
+	}
+
+	Recording = NewRecording;
+	ReplayFrameIndex = 0;
+	ReplayResult = {};
+	bPreviousJumpPressed = false;
+
+	RestoreStartState();
+
+	// Apply the recorded input before the character and its movement are updated.
+
+	Character->AddTickPrerequisiteComponent(this);
+	Character->GetCharacterMovement()->AddTickPrerequisiteComponent(this);
+
+	SetComponentTickEnabled(true);
+}
+
+FAlsMovementReplayResult UAlsMovementRecorderComponent::StopReplay()
+{
+	if (!IsReplaying())
+	{
+		return {};
+	}
+
+	ReplayFrameIndex = INDEX_NONE;
+	Recording.Frames.Reset();
+
+	Character->RemoveTickPrerequisiteComponent(this);
+	Character->GetCharacterMovement()->RemoveTickPrerequisiteComponent(this);
+
+	SetComponentTickEnabled(false);
+
+	UE_LOG(LogAls, Log, __FUNCTION__ TEXT(": Replay finished: %d frames, %d mismatched, max location error %.3f cm,")
+	       TEXT(" max rotation error %.3f deg."), ReplayResult.NumFrames, ReplayResult.NumMismatchedFrames,
+	       ReplayResult.MaxLocationError, ReplayResult.MaxRotationError);
+
+	return ReplayResult;
+}
+
+bool UAlsMovementRecorderComponent::SaveRecording(const FAlsMovementRecording& SourceRecording, const FString& FilePath)
+{
+	FString Json;
+
+	return FJsonObjectConverter::UStructToJsonObjectString(SourceRecording, Json) &&
+	       FFileHelper::SaveStringToFile(Json, *FilePath);
+}
+
+bool UAlsMovementRecorderComponent::LoadRecording(const FString& FilePath, FAlsMovementRecording& TargetRecording)
+{
+	FString Json;
+
+	return FFileHelper::LoadFileToString(Json, *FilePath) &&
+	       FJsonObjectConverter::JsonObjectStringToUStruct(Json, &TargetRecording);
+}
+
+void UAlsMovementRecorderComponent::RestoreStartState()
+{
+	Character->TeleportTo(Recording.StartLocation, Recording.StartRotation, false, true);
+
+	// The desired state is restored first so that the locomotion mode change applies the recorded desired stance.
+
+	Character->SetDesiredRotationMode(Recording.StartDesiredRotationMode);
+	Character->SetDesiredStance(Recording.StartDesiredStance);
+	Character->SetDesiredGait(Recording.StartDesiredGait);
+	Character->SetDesiredAiming(Recording.bStartDesiredAiming);
+
+	auto* CharacterMovement{Character->GetCharacterMovement()};
+
+	Character->StopJumping();
+
+	CharacterMovement->SetMovementMode(Recording.StartMovementMode, Recording.StartCustomMovementMode);
+	CharacterMovement->Velocity = Recording.StartVelocity;
+
+	Character->RestoreRecordedState(Recording.StartLocomotionMode, Recording.StartRotationMode,
+	                                Recording.StartStance, Recording.StartGait);
+}
+
+void UAlsMovementRecorderComponent::RecordFrame(const float DeltaTime)
+{
+	auto& Frame{Recording.Frames.AddDefaulted_GetRef()};
+
+	Frame.DeltaTime = DeltaTime;
+	Frame.MovementInput = Character->GetCharacterMovement()->GetLastInputVector();
+	Frame.ViewRotation = Character->GetControlRotation();
+	Frame.DesiredRotationMode = Character->GetDesiredRotationMode();
+	Frame.DesiredStance = Character->GetDesiredStance();
+	Frame.DesiredGait = Character->GetDesiredGait();
+	Frame.bDesiredAiming = Character->IsDesiredAiming();
+
+	// The frame is recorded after the character movement update, which clears the jump input once the jump max
+	// hold time has been reached, so a jump that has started in this frame also counts as a pressed jump input.
+
+	Frame.bJumpPressed = Character->bPressedJump || Character->JumpCurrentCount > PreviousJumpCount;
+
+	// Locomotion actions are not recorded directly, so they are restored from the changes in the character
+	// state. Actions that were started automatically by a locomotion mode change, such as rolling or
+	// ragdolling on landing, are skipped because they will start automatically again during the replay.
+
+	auto Actions{EAlsMovementRecordingActions::None};
+
+	if (Character->GetLocomotionAction() != PreviousLocomotionAction)
+	{
+		const auto bLocomotionModeChanged{Character->GetLocomotionMode() != PreviousLocomotionMode};
+
+		if (Character->GetLocomotionAction() == AlsLocomotionActionTags::Rolling && !bLocomotionModeChanged)
+		{
+			Actions |= EAlsMovementRecordingActions::Roll;
+		}
+		else if (Character->GetLocomotionAction() == AlsLocomotionActionTags::Mantling &&
+		         PreviousLocomotionMode == AlsLocomotionModeTags::Grounded)
+		{
+			Actions |= EAlsMovementRecordingActions::Mantle;
+		}
+		else if (Character->GetLocomotionAction() == AlsLocomotionActionTags::Ragdolling && !bLocomotionModeChanged)
+		{
+			Actions |= EAlsMovementRecordingActions::Ragdoll;
+		}
+	}
+
+	Frame.Actions = static_cast<uint8>(Actions);
+
+	Frame.Location = Character->GetActorLocation();
+	Frame.Rotation = Character->GetActorRotation();
+	Frame.LocomotionMode = Character->GetLocomotionMode();
+	Frame.LocomotionAction = Character->GetLocomotionAction();
+	Frame.Stance = Character->GetStance();
+	Frame.Gait = Character->GetGait();
+
+	PreviousJumpCount = Character->JumpCurrentCount;
+	PreviousLocomotionMode = Character->GetLocomotionMode();
+	PreviousLocomotionAction = Character->GetLocomotionAction();
+}
+
+void UAlsMovementRecorderComponent::ReplayFrame(const float DeltaTime)
+{
+	// The result of the previous frame is only available now, after the whole previous frame has been simulated.
+
+	if (ReplayFrameIndex > 0)
+	{
+		CompareFrame(ReplayFrameIndex - 1);
+	}
+
+	if (!Recording.Frames.IsValidIndex(ReplayFrameIndex))
+	{
+		StopReplay();
+		return;
+	}
+
+	const auto& Frame{Recording.Frames[ReplayFrameIndex]};
+
+	if (!FMath::IsNearlyEqual(DeltaTime, Frame.DeltaTime, KINDA_SMALL_NUMBER) && ReplayResult.NumFrames <= 0)
+	{
+		UE_LOG(LogAls, Warning, __FUNCTION__ TEXT(": Replay delta time %.4f s doesn't match the recorded delta time %.4f s,")
+		       TEXT(" use a fixed time step!"), DeltaTime, Frame.DeltaTime);
+	}
+
+	ReplayFrameIndex += 1;
+
+	auto* Controller{Character->GetController()};
+	if (IsValid(Controller))
+	{
+		Controller->SetControlRotation(Frame.ViewRotation);
+	}
+
+	Character->SetDesiredRotationMode(Frame.DesiredRotationMode);
+	Character->SetDesiredStance(Frame.DesiredStance);
+	Character->SetDesiredGait(Frame.DesiredGait);
+	Character->SetDesiredAiming(Frame.bDesiredAiming);
+
+	Character->AddMovementInput(Frame.MovementInput, 1.0f, true);
+
+	// Press the jump only once per held input, because ACharacter::Jump() resets the jump key hold time.
+
+	if (!Frame.bJumpPressed)
+	{
+		Character->StopJumping();
+	}
+	else if (!bPreviousJumpPressed)
+	{
+		Character->Jump();
+	}
+
+	bPreviousJumpPressed = Frame.bJumpPressed;
+
+	const auto Actions{static_cast<EAlsMovementRecordingActions>(Frame.Actions)};
+
+	if (EnumHasAnyFlags(Actions, EAlsMovementRecordingActions::Roll))
+	{
+		Character->TryStartRolling();
+	}
+
+	if (EnumHasAnyFlags(Actions, EAlsMovementRecordingActions::Mantle))
+	{
+		Character->TryStartMantlingGrounded();
+	}
+
+	if (EnumHasAnyFlags(Actions, EAlsMovementRecordingActions::Ragdoll))
+	{
+		Character->StartRagdolling();
+	}
+}
+
+void UAlsMovementRecorderComponent::CompareFrame(const int32 FrameIndex)
+{
+	const auto& Frame{Recording.Frames[FrameIndex]};
+
+	const auto LocationError{UE_REAL_TO_FLOAT(FVector::Dist(Character->GetActorLocation(), Frame.Location))};
+	const auto RotationError{
+		UE_REAL_TO_FLOAT(FMath::RadiansToDegrees(Character->GetActorQuat().AngularDistance(Frame.Rotation.Quaternion())))
+	};
+
+	ReplayResult.NumFrames += 1;
+	ReplayResult.MaxLocationError = FMath::Max(ReplayResult.MaxLocationError, LocationError);
+	ReplayResult.MaxRotationError = FMath::Max(ReplayResult.MaxRotationError, RotationError);
+
+	if (LocationError <= LocationTolerance && RotationError <= RotationTolerance &&
+	    Character->GetLocomotionMode() == Frame.LocomotionMode &&
+	    Character->GetLocomotionAction() == Frame.LocomotionAction &&
+	    Character->GetStance() == Frame.Stance &&
+	    Character->GetGait() == Frame.Gait)
+	{
+		return;
+	}
+
+	ReplayResult.NumMismatchedFrames += 1;
+
+	if (ReplayResult.FirstMismatchedFrameIndex == INDEX_NONE)
+	{
+		ReplayResult.FirstMismatchedFrameIndex = FrameIndex;
+
+		UE_LOG(LogAls, Warning, __FUNCTION__ TEXT(": Replay diverged at frame %d: location error %.3f cm, rotation error %.3f deg,")
+		       TEXT(" locomotion mode %s (%s), locomotion action %s (%s), stance %s (%s), gait %s (%s)."),
+		       FrameIndex, LocationError, RotationError,
+		       *Character->GetLocomotionMode().ToString(), *Frame.LocomotionMode.ToString(),
+		       *Character->GetLocomotionAction().ToString(), *Frame.LocomotionAction.ToString(),
+		       *Character->GetStance().ToString(), *Frame.Stance.ToString(),
+		       *Character->GetGait().ToString(), *Frame.Gait.ToString());
+	}
+}
@@ -0,0 +1,7 @@
+#include "AlsNavArea_Mantling.h"
+
+UAlsNavArea_Mantling::UAlsNavArea_Mantling()
+{
+	DefaultCost = 2.0f;
+	DrawColor = FColor{255, 160, 0};
+}
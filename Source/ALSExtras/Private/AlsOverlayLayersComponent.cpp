@@ -0,0 +1,174 @@
+#include "AlsOverlayLayersComponent.h"
+
+#include "AlsCharacter.h"
+#include "Animation/AnimInstance.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+UAlsOverlayLayersComponent::UAlsOverlayLayersComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+}
+
+void UAlsOverlayLayersComponent::OnRegister()
+{
+	Character = Cast<AAlsCharacter>(GetOwner());
+
+	Super::OnRegister();
+}
+
+void UAlsOverlayLayersComponent::BeginPlay()
+{
+	ALS_ENSURE(IsValid(Character));
+
+	Super::BeginPlay();
+
+	if (IsValid(Character))
+	{
+		RefreshOverlayMode();
+	}
+}
+
+void UAlsOverlayLayersComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (const auto& Pair : StreamableHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->ReleaseHandle();
+		}
+	}
+
+	StreamableHandles.Reset();
+	ResidentOverlayModes.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAlsOverlayLayersComponent::TickComponent(const float DeltaTime, const ELevelTick TickType,
+                                               FActorComponentTickFunction* ThisTickFunction)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsOverlayLayersComponent::TickComponent()"),
+	                            STAT_UAlsOverlayLayersComponent_TickComponent, STATGROUP_Als)
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (IsValid(Character))
+	{
+		RefreshOverlayMode();
+	}
+}
+
+void UAlsOverlayLayersComponent::PreloadOverlayMode(const FGameplayTag& PredictedOverlayMode)
+{
+	LoadOverlayLayers(PredictedOverlayMode);
+}
+
+bool UAlsOverlayLayersComponent::IsOverlayModeLoaded(const FGameplayTag& OverlayModeToCheck) const
+{
+	// Overlay modes without their own layers use the default overlay layers, which are always loaded.
+
+	const auto* Layers{OverlayLayers.Find(OverlayModeToCheck)};
+
+	return Layers == nullptr || Layers->IsNull() || Layers->Get() != nullptr;
+}
+
+void UAlsOverlayLayersComponent::RefreshOverlayMode()
+{
+	if (OverlayMode == Character->GetOverlayMode())
+	{
+		return;
+	}
+
+	OverlayMode = Character->GetOverlayMode();
+
+	LoadOverlayLayers(OverlayMode);
+	ApplyOverlayLayers();
+}
+
+void UAlsOverlayLayersComponent::LoadOverlayLayers(const FGameplayTag& NewOverlayMode)
+{
+	const auto* Layers{OverlayLayers.Find(NewOverlayMode)};
+	if (Layers == nullptr || Layers->IsNull())
+	{
+		return;
+	}
+
+	ResidentOverlayModes.Remove(NewOverlayMode);
+	ResidentOverlayModes.Add(NewOverlayMode);
+
+	if (!StreamableHandles.Contains(NewOverlayMode))
+	{
+		auto Handle{
+			UAssetManager::GetStreamableManager().RequestAsyncLoad(
+				Layers->ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &ThisClass::OnOverlayLayersLoaded, NewOverlayMode))
+		};
+
+		StreamableHandles.Add(NewOverlayMode, MoveTemp(Handle));
+	}
+
+	ReleaseUnusedOverlayLayers();
+}
+
+void UAlsOverlayLayersComponent::OnOverlayLayersLoaded(const FGameplayTag LoadedOverlayMode)
+{
+	if (LoadedOverlayMode == OverlayMode && IsValid(Character))
+	{
+		ApplyOverlayLayers();
+	}
+}
+
+void UAlsOverlayLayersComponent::ReleaseUnusedOverlayLayers()
+{
+	for (auto i{0}; i < ResidentOverlayModes.Num() && ResidentOverlayModes.Num() > MaxResidentOverlayLayers;)
+	{
+		// The layers of the current overlay mode are never released, even if they are the least recently used.
+
+		if (ResidentOverlayModes[i] == OverlayMode)
+		{
+			i++;
+			continue;
+		}
+
+		TSharedPtr<FStreamableHandle> Handle;
+		if (StreamableHandles.RemoveAndCopyValue(ResidentOverlayModes[i], Handle) && Handle.IsValid())
+		{
+			Handle->ReleaseHandle();
+		}
+
+		ResidentOverlayModes.RemoveAt(i);
+	}
+}
+
+void UAlsOverlayLayersComponent::ApplyOverlayLayers()
+{
+	const auto* Layers{OverlayLayers.Find(OverlayMode)};
+	const TSubclassOf<UAnimInstance> NewOverlayLayers{Layers != nullptr ? Layers->Get() : nullptr};
+
+	LinkOverlayLayers(IsValid(NewOverlayLayers) ? NewOverlayLayers : DefaultOverlayLayers);
+}
+
+void UAlsOverlayLayersComponent::LinkOverlayLayers(const TSubclassOf<UAnimInstance> NewOverlayLayers)
+{
+	if (LinkedOverlayLayers == NewOverlayLayers)
+	{
+		return;
+	}
+
+	auto* Mesh{Character->GetMesh()};
+
+	if (IsValid(LinkedOverlayLayers))
+	{
+		Mesh->UnlinkAnimClassLayers(LinkedOverlayLayers);
+	}
+
+	LinkedOverlayLayers = NewOverlayLayers;
+
+	if (IsValid(LinkedOverlayLayers))
+	{
+		Mesh->LinkAnimClassLayers(LinkedOverlayLayers);
+	}
+}
@@ -0,0 +1,309 @@
+#include "AlsPathFollowingComponent.h"
+
+#include "AlsCharacter.h"
+#include "AlsNavArea_Mantling.h"
+#include "NavigationData.h"
+#include "GameFramework/NavMovementComponent.h"
+#include "Navigation/CrowdManager.h"
+#include "Utility/AlsUtility.h"
+
+#if WITH_RECAST
+#include "DetourCrowd/DetourCrowd.h"
+#include "NavMesh/RecastHelpers.h"
+#include "NavMesh/RecastNavMesh.h"
+#endif
+
+void UAlsPathFollowingComponent::SetMovementComponent(UNavMovementComponent* NewMovementComponent)
+{
+	Super::SetMovementComponent(NewMovementComponent);
+
+	Character = IsValid(NewMovementComponent) ? Cast<AAlsCharacter>(NewMovementComponent->GetOwner()) : nullptr;
+}
+
+void UAlsPathFollowingComponent::SetMoveSegment(const int32 SegmentStartIndex)
+{
+	Super::SetMoveSegment(SegmentStartIndex);
+
+	StopMantlingSegment();
+
+	if (!Path.IsValid() || !Path->GetPathPoints().IsValidIndex(SegmentStartIndex + 1))
+	{
+		return;
+	}
+
+	// Without crowd simulation, the path is string pulled, so mantling links are present as path points.
+
+	const auto* NavigationData{Path->GetNavigationDataUsed()};
+	const auto& PathPoints{Path->GetPathPoints()};
+	const FNavMeshNodeFlags PointFlags{PathPoints[SegmentStartIndex].Flags};
+
+	if (IsValid(NavigationData) && PointFlags.IsNavLink())
+	{
+		const auto* AreaClass{NavigationData->GetAreaClass(PointFlags.Area)};
+		if (IsValid(AreaClass) && AreaClass->IsChildOf(UAlsNavArea_Mantling::StaticClass()))
+		{
+			StartMantlingSegment(PathPoints[SegmentStartIndex].Location, PathPoints[SegmentStartIndex + 1].Location);
+		}
+	}
+}
+
+void UAlsPathFollowingComponent::FollowPathSegment(const float DeltaTime)
+{
+	if (!IsValid(Character))
+	{
+		Super::FollowPathSegment(DeltaTime);
+		return;
+	}
+
+	RefreshDesiredGait(DeltaTime);
+
+	if (bMantlingSegment || TryStartCrowdMantlingSegment())
+	{
+		FollowMantlingSegment(DeltaTime);
+		return;
+	}
+
+	Super::FollowPathSegment(DeltaTime);
+}
+
+void UAlsPathFollowingComponent::OnPathFinished(const FPathFollowingResult& Result)
+{
+	StopMantlingSegment();
+
+	Super::OnPathFinished(Result);
+}
+
+void UAlsPathFollowingComponent::StartMantlingSegment(const FVector& LinkStartLocation, const FVector& LinkEndLocation)
+{
+	bMantlingSegment = true;
+	bMantlingStarted = false;
+	MantlingLinkStartLocation = LinkStartLocation;
+	MantlingLinkEndLocation = LinkEndLocation;
+	MantlingRetryTimeRemaining = 0.0f;
+}
+
+void UAlsPathFollowingComponent::StopMantlingSegment()
+{
+	bMantlingSegment = false;
+	bMantlingStarted = false;
+
+	if (bCrowdSteeringSuspendedForMantling)
+	{
+		bCrowdSteeringSuspendedForMantling = false;
+		SuspendCrowdSteering(false);
+	}
+}
+
+bool UAlsPathFollowingComponent::TryStartCrowdMantlingSegment()
+{
+#if WITH_RECAST
+	if (!IsCrowdSimulationEnabled() || IsCrowdSimulatioSuspended() || !Path.IsValid())
+	{
+		return false;
+	}
+
+	const auto* NavMesh{Cast<ARecastNavMesh>(Path->GetNavigationDataUsed())};
+	const auto* CrowdManager{UCrowdManager::GetCurrent(GetWorld())};
+	const auto* CrowdAgent{IsValid(NavMesh) && IsValid(CrowdManager) ? CrowdManager->GetDetourCrowdAgent(this) : nullptr};
+
+	if (CrowdAgent == nullptr)
+	{
+		return false;
+	}
+
+	// The crowd agent cuts its corners at the first off-mesh connection, so only the last corner can start a link.
+
+	const auto CornerIndex{CrowdAgent->ncorners - 1};
+
+	if (CornerIndex < 0 || (CrowdAgent->cornerFlags[CornerIndex] & DT_STRAIGHTPATH_OFFMESH_CONNECTION) == 0)
+	{
+		return false;
+	}
+
+	const auto LinkPolyRef{CrowdAgent->cornerPolys[CornerIndex]};
+	const auto* AreaClass{NavMesh->GetAreaClass(NavMesh->GetPolyAreaID(LinkPolyRef))};
+
+	if (!IsValid(AreaClass) || !AreaClass->IsChildOf(UAlsNavArea_Mantling::StaticClass()))
+	{
+		return false;
+	}
+
+	const auto LinkStartLocation{Recast2UnrealPoint(&CrowdAgent->cornerVerts[CornerIndex * 3])};
+
+	if (FVector::DistSquared2D(GetCurrentNavLocation(), LinkStartLocation) > FMath::Square(MantlingStartDistance))
+	{
+		return false;
+	}
+
+	FVector LinkPointA;
+	FVector LinkPointB;
+
+	if (!NavMesh->GetLinkEndPoints(LinkPolyRef, LinkPointA, LinkPointB))
+	{
+		return false;
+	}
+
+	// Take over from the crowd simulation, otherwise it would move the agent along the link on its own.
+
+	SuspendCrowdSteering(true);
+	bCrowdSteeringSuspendedForMantling = true;
+
+	StartMantlingSegment(LinkStartLocation,
+	                     FVector::DistSquared(LinkStartLocation, LinkPointA) > FVector::DistSquared(LinkStartLocation, LinkPointB)
+		                     ? LinkPointA
+		                     : LinkPointB);
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void UAlsPathFollowingComponent::FollowMantlingSegment(const float DeltaTime)
+{
+	// Don't apply any movement input while mantling, the segment end will be reached once mantling is finished.
+
+	if (Character->GetLocomotionAction() == AlsLocomotionActionTags::Mantling)
+	{
+		bMantlingStarted = true;
+		return;
+	}
+
+	if (bMantlingStarted && bCrowdSteeringSuspendedForMantling)
+	{
+		// The crowd agent's corridor still ends before the link, so hand control back
+		// to the crowd simulation and request a new path from the top of the ledge.
+
+		StopMantlingSegment();
+		Path->Invalidate();
+		return;
+	}
+
+	// Keep moving towards the ledge so that the mantling traces point in the right direction.
+
+	if (bCrowdSteeringSuspendedForMantling)
+	{
+		MovementComp->RequestPathMove((MantlingLinkEndLocation - GetCurrentNavLocation()).GetSafeNormal2D());
+	}
+	else
+	{
+		Super::FollowPathSegment(DeltaTime);
+	}
+
+	if (bMantlingStarted)
+	{
+		return;
+	}
+
+	// Mantling traces are relatively expensive, so try to start mantling only close to the link and not every frame.
+
+	MantlingRetryTimeRemaining -= DeltaTime;
+
+	if (MantlingRetryTimeRemaining <= 0.0f &&
+	    FVector::DistSquared2D(GetCurrentNavLocation(), MantlingLinkStartLocation) <= FMath::Square(MantlingStartDistance))
+	{
+		MantlingRetryTimeRemaining = MantlingRetryInterval;
+
+		Character->TryStartMantlingGrounded();
+	}
+}
+
+void UAlsPathFollowingComponent::RefreshDesiredGait(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsPathFollowingComponent::RefreshDesiredGait()"),
+	                            STAT_UAlsPathFollowingComponent_RefreshDesiredGait, STATGROUP_Als)
+
+	if (!bSelectDesiredGait || Character->GetLocalRole() < ROLE_Authority)
+	{
+		return;
+	}
+
+	const auto TargetGait{SelectDesiredGait()};
+
+	if (TargetGait == Character->GetDesiredGait())
+	{
+		PendingGait = FGameplayTag::EmptyTag;
+		PendingGaitTime = 0.0f;
+		return;
+	}
+
+	if (TargetGait != PendingGait)
+	{
+		PendingGait = TargetGait;
+		PendingGaitTime = 0.0f;
+	}
+
+	PendingGaitTime += DeltaTime;
+
+	if (PendingGaitTime >= GaitChangeDelay)
+	{
+		Character->SetDesiredGait(PendingGait);
+	}
+}
+
+FGameplayTag UAlsPathFollowingComponent::SelectDesiredGait() const
+{
+	const auto* CrowdManager{UCrowdManager::GetCurrent(GetWorld())};
+
+	if (IsCrowdSimulationEnabled() && IsValid(CrowdManager) && CrowdManager->GetNumNearbyAgents(this) >= CrowdedAgentsCount)
+	{
+		return SlowGait;
+	}
+
+	if (!Path.IsValid())
+	{
+		return FastGait;
+	}
+
+	// Check the angle between the current and the next path segment if the character is close enough to the corner.
+
+	FVector PreviousLocation;
+	FVector CornerLocation;
+	FVector NextLocation;
+
+	if (!FindNextCorner(PreviousLocation, CornerLocation, NextLocation) ||
+	    FVector::DistSquared2D(GetCurrentNavLocation(), CornerLocation) > FMath::Square(SharpCornerDistance))
+	{
+		return FastGait;
+	}
+
+	const auto CurrentDirection{(CornerLocation - PreviousLocation).GetSafeNormal2D()};
+	const auto NextDirection{(NextLocation - CornerLocation).GetSafeNormal2D()};
+
+	return (CurrentDirection | NextDirection) < FMath::Cos(FMath::DegreesToRadians(SharpCornerAngle)) ? SlowGait : FastGait;
+}
+
+bool UAlsPathFollowingComponent::FindNextCorner(FVector& PreviousLocation, FVector& CornerLocation, FVector& NextLocation) const
+{
+#if WITH_RECAST
+	if (IsCrowdSimulationEnabled() && !IsCrowdSimulatioSuspended())
+	{
+		// Crowd paths are not string pulled, so use the corners that the crowd agent is currently steering through.
+
+		const auto* CrowdManager{UCrowdManager::GetCurrent(GetWorld())};
+		const auto* CrowdAgent{IsValid(CrowdManager) ? CrowdManager->GetDetourCrowdAgent(this) : nullptr};
+
+		if (CrowdAgent == nullptr || CrowdAgent->ncorners < 2)
+		{
+			return false;
+		}
+
+		PreviousLocation = GetCurrentNavLocation();
+		CornerLocation = Recast2UnrealPoint(&CrowdAgent->cornerVerts[0]);
+		NextLocation = Recast2UnrealPoint(&CrowdAgent->cornerVerts[3]);
+		return true;
+	}
+#endif
+
+	const auto& PathPoints{Path->GetPathPoints()};
+
+	if (!PathPoints.IsValidIndex(MoveSegmentStartIndex) || !PathPoints.IsValidIndex(MoveSegmentEndIndex + 1))
+	{
+		return false;
+	}
+
+	PreviousLocation = PathPoints[MoveSegmentStartIndex].Location;
+	CornerLocation = PathPoints[MoveSegmentEndIndex].Location;
+	NextLocation = PathPoints[MoveSegmentEndIndex + 1].Location;
+	return true;
+}
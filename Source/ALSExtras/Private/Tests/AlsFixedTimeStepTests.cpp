@@ -0,0 +1,225 @@
+#include "AlsCharacter.h"
+#include "AlsCharacterMovementComponent.h"
+#include "AlsMovementRecorderComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsFixedTimeStepTests
+{
+	// Both frame rates are multiples or divisors of the default 60 Hz fixed time step, so that
+	// both of them simulate the same number of steps over the same duration without rounding errors.
+
+	static constexpr auto HighFrameRate{120};
+	static constexpr auto LowFrameRate{30};
+
+	// In seconds.
+	static constexpr auto WarmUpDuration{1};
+	static constexpr auto MoveDuration{2};
+
+	static constexpr auto LocationTolerance{1.0f};
+	static constexpr auto RotationTolerance{1.0f};
+
+	// Number of frames to wait for the map to load and the player character to spawn.
+	static constexpr auto MaxStartFrames{600};
+
+	// The view is turned away from the character and the character moves diagonally to it,
+	// so that the character both moves and rotates towards the view direction.
+
+	const FRotator ViewRotation{0.0f, 90.0f, 0.0f};
+	const FVector MovementInput{1.0f, 1.0f, 0.0f};
+
+	// Spawns a character of the given class, drives it manually at the given frame rate, and returns its
+	// transforms at the end of each low frame rate frame, so that the results of both frame rates can be compared.
+	TArray<FTransform> Simulate(UWorld* World, const TSubclassOf<AAlsCharacter> CharacterClass,
+	                            const FTransform& StartTransform, const int32 FrameRate)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+		auto* Character{World->SpawnActor<AAlsCharacter>(CharacterClass, StartTransform, SpawnParameters)};
+		if (!IsValid(Character))
+		{
+			return {};
+		}
+
+		Character->SpawnDefaultController();
+
+		auto* Controller{Character->GetController()};
+		auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
+
+		TArray<FTransform> Samples;
+
+		if (IsValid(Controller) && IsValid(Movement))
+		{
+			Movement->SetUseFixedTimeStep(true);
+			Controller->SetControlRotation(ViewRotation);
+
+			// The world doesn't tick while the simulation is driven manually, so the character and its
+			// movement are ticked in the same order as the world ticks them: the movement first.
+
+			Character->SetActorTickEnabled(false);
+			Movement->SetComponentTickEnabled(false);
+
+			const auto DeltaTime{1.0f / static_cast<float>(FrameRate)};
+			const auto FramesPerSample{FrameRate / LowFrameRate};
+
+			// Let the character settle on the ground and react to the view rotation before it starts to move.
+
+			for (auto i{1}; i <= FrameRate * (WarmUpDuration + MoveDuration); i++)
+			{
+				if (i > FrameRate * WarmUpDuration)
+				{
+					Character->AddMovementInput(MovementInput, 1.0f, true);
+				}
+
+				Movement->TickComponent(DeltaTime, LEVELTICK_All, &Movement->PrimaryComponentTick);
+				Character->Tick(DeltaTime);
+
+				if (i % FramesPerSample == 0)
+				{
+					Samples.Add(Character->GetActorTransform());
+				}
+			}
+		}
+
+		if (IsValid(Controller))
+		{
+			Controller->Destroy();
+		}
+
+		Character->Destroy();
+
+		return Samples;
+	}
+}
+
+// Moves a character with the same input at two frame rates and fails if its location or rotation differs between them.
+class FAlsFixedTimeStepFrameRateCommand : public IAutomationLatentCommand
+{
+private:
+	FAutomationTestBase* Test;
+
+	int32 NumUpdates{0};
+
+public:
+	explicit FAlsFixedTimeStepFrameRateCommand(FAutomationTestBase* NewTest) : Test{NewTest} {}
+
+	virtual bool Update() override
+	{
+		using namespace AlsFixedTimeStepTests;
+
+		NumUpdates += 1;
+
+		if (NumUpdates > MaxStartFrames)
+		{
+			Test->AddError(TEXT("The player character didn't spawn."));
+			return true;
+		}
+
+		auto* World{AutomationCommon::GetAnyGameWorld()};
+		const auto* PlayerController{IsValid(World) ? World->GetFirstPlayerController() : nullptr};
+		auto* PlayerCharacter{IsValid(PlayerController) ? Cast<AAlsCharacter>(PlayerController->GetPawn()) : nullptr};
+
+		if (!IsValid(PlayerCharacter) || !PlayerCharacter->HasActorBegunPlay())
+		{
+			// Wait for the player character to spawn.
+			return false;
+		}
+
+		// The test characters are spawned in place of the player character, whose
+		// collision is disabled for the duration of the test to avoid overlaps.
+
+		const auto StartTransform{PlayerCharacter->GetActorTransform()};
+
+		PlayerCharacter->SetActorEnableCollision(false);
+
+		const auto HighFrameRateSamples{Simulate(World, PlayerCharacter->GetClass(), StartTransform, HighFrameRate)};
+		const auto LowFrameRateSamples{Simulate(World, PlayerCharacter->GetClass(), StartTransform, LowFrameRate)};
+
+		PlayerCharacter->SetActorEnableCollision(true);
+
+		if (HighFrameRateSamples.Num() <= 0 || !Test->TestEqual(TEXT("Number of samples"),
+		                                                        LowFrameRateSamples.Num(), HighFrameRateSamples.Num()))
+		{
+			Test->AddError(TEXT("Failed to simulate the character."));
+			return true;
+		}
+
+		auto MaxLocationError{0.0f};
+		auto MaxRotationError{0.0f};
+
+		for (auto i{0}; i < HighFrameRateSamples.Num(); i++)
+		{
+			const auto& HighFrameRateSample{HighFrameRateSamples[i]};
+			const auto& LowFrameRateSample{LowFrameRateSamples[i]};
+
+			const auto LocationError{UE_REAL_TO_FLOAT(FVector::Dist(HighFrameRateSample.GetLocation(), LowFrameRateSample.GetLocation()))};
+			const auto AngularDistance{HighFrameRateSample.GetRotation().AngularDistance(LowFrameRateSample.GetRotation())};
+			const auto RotationError{UE_REAL_TO_FLOAT(FMath::RadiansToDegrees(AngularDistance))};
+
+			MaxLocationError = FMath::Max(MaxLocationError, LocationError);
+			MaxRotationError = FMath::Max(MaxRotationError, RotationError);
+		}
+
+		Test->TestTrue(FString::Printf(TEXT("Location error between %d Hz and %d Hz (%.3f cm)"),
+		                               HighFrameRate, LowFrameRate, MaxLocationError),
+		               MaxLocationError <= LocationTolerance);
+
+		Test->TestTrue(FString::Printf(TEXT("Rotation error between %d Hz and %d Hz (%.3f deg)"),
+		                               HighFrameRate, LowFrameRate, MaxRotationError),
+		               MaxRotationError <= RotationTolerance);
+
+		Test->TestTrue(TEXT("Character moved"), FVector::Dist(HighFrameRateSamples.Last().GetLocation(),
+		                                                      StartTransform.GetLocation()) > LocationTolerance);
+		return true;
+	}
+};
+
+// Runs on the maps of the golden recordings from the Tests/AlsMovementRecordings project directory,
+// because they are known to have ground at the player start, see the Als.MovementReplay test.
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAlsFixedTimeStepFrameRateTest, "Als.FixedTimeStep.FrameRateIndependence",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                  EAutomationTestFlags::ProductFilter)
+
+void FAlsFixedTimeStepFrameRateTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	const auto RecordingsDirectory{FPaths::ProjectDir() / TEXT("Tests") / TEXT("AlsMovementRecordings")};
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(RecordingsDirectory / TEXT("*.json")), true, false);
+
+	for (const auto& FileName : FileNames)
+	{
+		FAlsMovementRecording Recording;
+
+		if (UAlsMovementRecorderComponent::LoadRecording(RecordingsDirectory / FileName, Recording) &&
+		    !Recording.Map.IsEmpty() && !OutTestCommands.Contains(Recording.Map))
+		{
+			OutBeautifiedNames.Add(FPackageName::GetShortName(Recording.Map));
+			OutTestCommands.Add(Recording.Map);
+		}
+	}
+}
+
+bool FAlsFixedTimeStepFrameRateTest::RunTest(const FString& Parameters)
+{
+	if (!AutomationOpenMap(Parameters))
+	{
+		AddError(FString::Printf(TEXT("Failed to open the %s map."), *Parameters));
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsFixedTimeStepFrameRateCommand(this))
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,163 @@
+#include "AlsCharacter.h"
+#include "AlsMovementRecorderComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsMovementReplayTests
+{
+	// Number of frames to wait for the map to load and the player character to spawn.
+	static constexpr auto MaxStartFrames{600};
+
+	FString GetRecordingsDirectory()
+	{
+		return FPaths::ProjectDir() / TEXT("Tests") / TEXT("AlsMovementRecordings");
+	}
+}
+
+// Replays a recording on the character of the first local player and fails if any frame doesn't match the recording.
+class FAlsMovementReplayCommand : public IAutomationLatentCommand
+{
+private:
+	FAutomationTestBase* Test;
+
+	FAlsMovementRecording Recording;
+
+	TWeakObjectPtr<UAlsMovementRecorderComponent> Recorder;
+
+	bool bReplayStarted{false};
+
+	int32 NumUpdates{0};
+
+public:
+	FAlsMovementReplayCommand(FAutomationTestBase* NewTest, const FAlsMovementRecording& NewRecording)
+		: Test{NewTest}, Recording{NewRecording} {}
+
+	virtual bool Update() override
+	{
+		NumUpdates += 1;
+
+		if (NumUpdates > Recording.Frames.Num() * 2 + AlsMovementReplayTests::MaxStartFrames)
+		{
+			Test->AddError(TEXT("The replay timed out."));
+			return true;
+		}
+
+		if (!bReplayStarted)
+		{
+			return !TryStartReplay();
+		}
+
+		if (!Recorder.IsValid())
+		{
+			Test->AddError(TEXT("The character was destroyed during the replay."));
+			return true;
+		}
+
+		if (Recorder->IsReplaying())
+		{
+			return false;
+		}
+
+		const auto& Result{Recorder->GetReplayResult()};
+
+		Test->TestEqual(TEXT("Number of replayed frames"), Result.NumFrames, Recording.Frames.Num());
+
+		if (Result.NumMismatchedFrames > 0)
+		{
+			Test->AddError(FString::Printf(TEXT("%d frames mismatched, starting at frame %d: max location error %.3f cm,")
+			                               TEXT(" max rotation error %.3f deg."), Result.NumMismatchedFrames,
+			                               Result.FirstMismatchedFrameIndex, Result.MaxLocationError, Result.MaxRotationError));
+		}
+
+		return true;
+	}
+
+private:
+	// Returns true when the replay doesn't need to be started anymore, either because it has started or because it failed to.
+	bool TryStartReplay()
+	{
+		const auto* World{AutomationCommon::GetAnyGameWorld()};
+		const auto* PlayerController{IsValid(World) ? World->GetFirstPlayerController() : nullptr};
+		auto* Character{IsValid(PlayerController) ? Cast<AAlsCharacter>(PlayerController->GetPawn()) : nullptr};
+
+		if (!IsValid(Character) || !Character->HasActorBegunPlay())
+		{
+			// Wait for the player character to spawn.
+			return false;
+		}
+
+		auto* NewRecorder{Character->FindComponentByClass<UAlsMovementRecorderComponent>()};
+		if (!IsValid(NewRecorder))
+		{
+			NewRecorder = NewObject<UAlsMovementRecorderComponent>(Character);
+			NewRecorder->RegisterComponent();
+		}
+
+		NewRecorder->StartReplay(Recording);
+
+		if (!NewRecorder->IsReplaying())
+		{
+			Test->AddError(TEXT("Failed to start the replay."));
+			return true;
+		}
+
+		Recorder = NewRecorder;
+		bReplayStarted = true;
+		return true;
+	}
+};
+
+// Replays all golden recordings from the Tests/AlsMovementRecordings project directory. For reproducible results, run the test in a
+// game with a fixed frame rate that matches the recordings, for example, with the -UseFixedTimeStep -FPS=60 -NullRHI arguments.
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAlsMovementReplayTest, "Als.MovementReplay",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                  EAutomationTestFlags::ProductFilter)
+
+void FAlsMovementReplayTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	const auto RecordingsDirectory{AlsMovementReplayTests::GetRecordingsDirectory()};
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(RecordingsDirectory / TEXT("*.json")), true, false);
+
+	for (const auto& FileName : FileNames)
+	{
+		OutBeautifiedNames.Add(FPaths::GetBaseFilename(FileName));
+		OutTestCommands.Add(RecordingsDirectory / FileName);
+	}
+}
+
+bool FAlsMovementReplayTest::RunTest(const FString& Parameters)
+{
+	FAlsMovementRecording Recording;
+
+	if (!UAlsMovementRecorderComponent::LoadRecording(Parameters, Recording))
+	{
+		AddError(FString::Printf(TEXT("Failed to load the %s recording."), *Parameters));
+		return false;
+	}
+
+	if (Recording.Map.IsEmpty() || Recording.Frames.Num() <= 0)
+	{
+		AddError(FString::Printf(TEXT("The %s recording has no map or no frames."), *Parameters));
+		return false;
+	}
+
+	if (!AutomationOpenMap(Recording.Map))
+	{
+		AddError(FString::Printf(TEXT("Failed to open the %s map."), *Recording.Map));
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsMovementReplayCommand(this, Recording))
+
+	return true;
+}
+
+#endif
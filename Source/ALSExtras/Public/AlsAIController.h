@@ -12,12 +12,22 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	TObjectPtr<UBehaviorTree> BehaviorTree;
 
+	// How often the control rotation and the focus target of the character are updated. Zero means every frame. With
+	// a greater value, the character interpolates its view rotation between updates, see FAlsViewSettings::FocusInterpolationSpeed.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float FocusUpdateInterval{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	float FocusUpdateTimeRemaining;
+
 public:
-	AAlsAIController();
+	explicit AAlsAIController(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 protected:
 	virtual void OnPossess(APawn* NewPawn) override;
 
 public:
+	virtual void UpdateControlRotation(float DeltaTime, bool bUpdatePawn = true) override;
+
 	virtual FVector GetFocalPointOnActor(const AActor* Actor) const override;
 };
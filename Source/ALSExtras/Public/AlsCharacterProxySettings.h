@@ -0,0 +1,28 @@
+#pragma once
+
+#include "AlsCharacterProxySettings.generated.h"
+
+class UStaticMesh;
+
+USTRUCT(BlueprintType)
+struct ALSEXTRAS_API FAlsCharacterProxySettings
+{
+	GENERATED_BODY()
+
+	// If enabled, the server makes AI-controlled characters that are farther than the demotion distance from all
+	// players dormant and moves lightweight proxies in their place, see UAlsCharacterProxySubsystem.
+	// Proxies are not replicated to clients.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bEnabled{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnabled", ClampMin = 0, ForceUnits = "cm"))
+	float DemotionDistance{15000.0f};
+
+	// Should be less than the demotion distance to prevent frequent switching.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnabled", ClampMin = 0, ForceUnits = "cm"))
+	float PromotionDistance{12000.0f};
+
+	// Optional mesh used to render proxies on listen servers and in standalone games.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnabled"))
+	TObjectPtr<UStaticMesh> Mesh;
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "AlsCharacterProxySettings.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsCharacterProxySubsystem.generated.h"
+
+class AAlsCharacter;
+class UActorComponent;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+// Lightweight representation of a distant character. The character itself is kept dormant while
+// the proxy moves in its place, and is woken up at the location of the proxy once it's needed again.
+USTRUCT(BlueprintType)
+struct ALSEXTRAS_API FAlsCharacterProxy
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<AAlsCharacter> Character;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsCharacterProxySettings Settings;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Location{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "cm/s"))
+	FVector Velocity{ForceInit};
+
+	// Offset from the location on the navigation mesh to the character location.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector NavigationLocationOffset{ForceInit};
+
+	// Remaining points of the path that the character was following when it was demoted.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FVector> PathPoints;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 NextPathPointIndex{0};
+
+	// Components of the character whose tick was disabled on demotion and must be enabled again on promotion.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<TObjectPtr<UActorComponent>> PausedComponents;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bActorTickWasEnabled{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bMeshWasRegistered{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	int32 InstanceIndex{INDEX_NONE};
+};
+
+// Makes distant characters dormant and replaces them with proxies that are moved by dead reckoning and optionally
+// rendered as static mesh instances. Dormant characters are hidden, don't tick, don't collide, have their mesh
+// unregistered and their AI controller paused, so they keep their identity and all their state, and are woken
+// up at the location of their proxy when they get close to a player. Only runs on the server. Proxies continue
+// along the path their character was following, are kept on the navigation mesh, and stop at the end of the
+// path or when the navigation mesh is blocked, since they don't have any collision.
+UCLASS()
+class ALSEXTRAS_API UAlsCharacterProxySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TArray<FAlsCharacterProxy> Proxies;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TMap<TObjectPtr<UStaticMesh>, TObjectPtr<UInstancedStaticMeshComponent>> InstancedMeshes;
+
+public:
+	virtual TStatId GetStatId() const override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	const TArray<FAlsCharacterProxy>& GetProxies() const;
+
+	bool IsNearAnyPlayer(const FVector& Location, float Distance) const;
+
+	// Captures the movement of the character into a new proxy and makes the character and its AI controller dormant.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character Proxy Subsystem")
+	bool DemoteCharacter(AAlsCharacter* Character, const FAlsCharacterProxySettings& Settings);
+
+	// Wakes the character of the proxy up at the location of the proxy and removes the proxy.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character Proxy Subsystem")
+	AAlsCharacter* PromoteProxy(int32 ProxyIndex);
+
+private:
+	void MoveProxy(FAlsCharacterProxy& Proxy, float DeltaTime) const;
+
+	void RefreshInstancedMeshes();
+
+	UInstancedStaticMeshComponent* GetOrCreateInstancedMesh(UStaticMesh* Mesh);
+
+	void RemoveProxyInstance(const FAlsCharacterProxy& Proxy);
+};
+
+inline const TArray<FAlsCharacterProxy>& UAlsCharacterProxySubsystem::GetProxies() const
+{
+	return Proxies;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "AlsCrowdSharingComponent.generated.h"
+
+class AAlsCharacter;
+class UAlsCrowdSharingSettings;
+struct FGameplayTag;
+
+// Switches a distant character from its own animation instance to a pose shared by all characters
+// in the same crowd state, and back to the individual animation instance when it gets close to a
+// local player camera, starts a locomotion action, or is explicitly requested to be individual.
+UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent))
+class ALSEXTRAS_API UAlsCrowdSharingComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TObjectPtr<UAlsCrowdSharingSettings> Settings;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TObjectPtr<AAlsCharacter> Character;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	bool bIndividualRequested;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	int32 SharedStateIndex{INDEX_NONE};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	bool bMeshUsedAbsoluteRotation;
+
+public:
+	UAlsCrowdSharingComponent();
+
+	virtual void OnRegister() override;
+
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	bool IsShared() const;
+
+	// Use this to keep the character individual while it is targeted or otherwise important to the player.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Crowd Sharing")
+	void SetIndividualRequested(bool bNewIndividualRequested);
+
+private:
+	void Character_OnLocomotionActionChanged(const FGameplayTag& PreviousLocomotionAction);
+
+	bool ShouldBeIndividual() const;
+
+	bool ShouldBecomeProxy() const;
+
+	void StartSharing(int32 StateIndex);
+
+	void StopSharing();
+};
+
+inline bool UAlsCrowdSharingComponent::IsShared() const
+{
+	return SharedStateIndex != INDEX_NONE;
+}
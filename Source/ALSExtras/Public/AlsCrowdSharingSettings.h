@@ -0,0 +1,64 @@
+#pragma once
+
+#include "AlsCharacterProxySettings.h"
+#include "GameplayTagContainer.h"
+#include "Engine/DataAsset.h"
+#include "AlsCrowdSharingSettings.generated.h"
+
+class AAlsCharacter;
+class UAnimSequenceBase;
+
+USTRUCT(BlueprintType)
+struct ALSEXTRAS_API FAlsCrowdSharingState
+{
+	GENERATED_BODY()
+
+	// An empty tag matches any locomotion mode.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag LocomotionMode;
+
+	// An empty tag matches any stance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance;
+
+	// An empty tag matches any gait.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Gait;
+
+	// An empty tag matches any overlay mode.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag OverlayMode;
+
+	// Looped animation played by the shared leader pose of this state.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> Animation;
+};
+
+UCLASS(Blueprintable, BlueprintType)
+class ALSEXTRAS_API UAlsCrowdSharingSettings : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float UpdateInterval{0.25f};
+
+	// The character will use its own animation instance if it is closer than this distance to any local player camera.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float IndividualDistance{2500.0f};
+
+	// The character will switch back to a shared pose only if it is farther than this distance from all
+	// local player cameras. Should be greater than the individual distance to prevent frequent switching.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float SharedDistance{3000.0f};
+
+	// States are checked in order, so more specific states should come first.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (TitleProperty = "Animation"))
+	TArray<FAlsCrowdSharingState> States;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsCharacterProxySettings Proxy;
+
+public:
+	int32 FindStateIndex(const AAlsCharacter& Character) const;
+};
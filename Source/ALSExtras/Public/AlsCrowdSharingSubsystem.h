@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsCrowdSharingSubsystem.generated.h"
+
+class UAnimSequenceBase;
+class USkeletalMesh;
+class USkeletalMeshComponent;
+
+USTRUCT()
+struct ALSEXTRAS_API FAlsCrowdSharingLeader
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<USkeletalMesh> Mesh;
+
+	UPROPERTY()
+	TObjectPtr<UAnimSequenceBase> Animation;
+
+	UPROPERTY()
+	TObjectPtr<USkeletalMeshComponent> Component;
+};
+
+// Owns hidden leader meshes that play shared crowd animations. Characters
+// with the same skeletal mesh in the same crowd state follow the same leader.
+UCLASS()
+class ALSEXTRAS_API UAlsCrowdSharingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Transient)
+	TArray<FAlsCrowdSharingLeader> Leaders;
+
+public:
+	virtual void Deinitialize() override;
+
+	USkeletalMeshComponent* GetOrCreateLeader(USkeletalMesh* Mesh, UAnimSequenceBase* Animation);
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Navigation/NavLinkProxy.h"
+#include "AlsMantlingNavLinkGenerator.generated.h"
+
+class AAlsCharacter;
+class UBoxComponent;
+
+// Places navigation links over ledges inside its bounds that can be mantled by the given character class.
+// Ledges are found using the same traces as the grounded mantling of the character, so links
+// always lead to locations where the character can actually mantle.
+UCLASS(DisplayName = "Als Mantling Nav Link Generator")
+class ALSEXTRAS_API AAlsMantlingNavLinkGenerator : public ANavLinkProxy
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Als Mantling Nav Link Generator")
+	TObjectPtr<UBoxComponent> Bounds;
+
+	// A temporary instance of this class is spawned to perform traces using its capsule, movement and mantling settings.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TSubclassOf<AAlsCharacter> CharacterClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 10, ForceUnits = "cm"))
+	float SampleSpacing{50.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 1, ClampMax = 32))
+	int32 DirectionsCount{8};
+
+	// A new link is skipped if both of its ends are closer than this distance to the ends of an already generated link.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MinLinkSpacing{100.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bGenerateLinksOnBeginPlay;
+
+public:
+	AAlsMantlingNavLinkGenerator();
+
+protected:
+	virtual void BeginPlay() override;
+
+public:
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "ALS|Als Mantling Nav Link Generator")
+	void GenerateLinks();
+
+private:
+	void AddLink(const FVector& StartLocation, const FVector& TargetLocation);
+};
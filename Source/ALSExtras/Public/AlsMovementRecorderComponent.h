@@ -0,0 +1,248 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "AlsMovementRecorderComponent.generated.h"
+
+class AAlsCharacter;
+
+UENUM(BlueprintType, Meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EAlsMovementRecordingActions : uint8
+{
+	None = 0 UMETA(Hidden),
+	Roll = 1 << 0,
+	Mantle = 1 << 1,
+	Ragdoll = 1 << 2
+};
+
+ENUM_CLASS_FLAGS(EAlsMovementRecordingActions)
+
+USTRUCT(BlueprintType)
+struct ALSEXTRAS_API FAlsMovementRecordingFrame
+{
+	GENERATED_BODY()
+
+	// Input
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float DeltaTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector MovementInput{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator ViewRotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag DesiredRotationMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag DesiredStance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag DesiredGait;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bDesiredAiming{false};
+
+	// Whether the jump input is held in this frame. The held state is recorded instead of individual
+	// jumps so that jumps whose height depends on the jump max hold time are reproduced correctly.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bJumpPressed{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (Bitmask, BitmaskEnum = "EAlsMovementRecordingActions"))
+	uint8 Actions{0};
+
+	// Result
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Location{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag LocomotionMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag LocomotionAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Gait;
+};
+
+USTRUCT(BlueprintType)
+struct ALSEXTRAS_API FAlsMovementRecording
+{
+	GENERATED_BODY()
+
+	// Package name of the map in which the recording was made.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FString Map;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector StartLocation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator StartRotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector StartVelocity{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TEnumAsByte<EMovementMode> StartMovementMode{MOVE_None};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 StartCustomMovementMode{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag StartDesiredRotationMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag StartDesiredStance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag StartDesiredGait;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bStartDesiredAiming{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag StartLocomotionMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag StartRotationMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag StartStance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag StartGait;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FAlsMovementRecordingFrame> Frames;
+};
+
+USTRUCT(BlueprintType)
+struct ALSEXTRAS_API FAlsMovementReplayResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 NumFrames{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 NumMismatchedFrames{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	int32 FirstMismatchedFrameIndex{INDEX_NONE};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MaxLocationError{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "deg"))
+	float MaxRotationError{0.0f};
+};
+
+// Records the inputs and the resulting movement of a locally controlled character, and replays them later to
+// check that changes to the movement, rotation, or locomotion action code preserve the behavior. Recordings can be
+// saved as golden files. For reproducible results, both recording and replay should run at a fixed frame rate,
+// for example, with the -UseFixedTimeStep -FPS=60 command line arguments, optionally in a headless game (-NullRHI).
+// Golden files from the Tests/AlsMovementRecordings project directory are replayed by the Als.MovementReplay
+// automation test, which fails if any frame of the replay doesn't match its recording.
+UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent))
+class ALSEXTRAS_API UAlsMovementRecorderComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float LocationTolerance{1.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
+	float RotationTolerance{1.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TObjectPtr<AAlsCharacter> Character;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	bool bRecording;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	int32 ReplayFrameIndex{INDEX_NONE};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsMovementRecording Recording;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsMovementReplayResult ReplayResult;
+
+	int32 PreviousJumpCount{0};
+
+	bool bPreviousJumpPressed{false};
+
+	FGameplayTag PreviousLocomotionMode;
+
+	FGameplayTag PreviousLocomotionAction;
+
+public:
+	UAlsMovementRecorderComponent();
+
+	virtual void OnRegister() override;
+
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	bool IsRecording() const;
+
+	bool IsReplaying() const;
+
+	const FAlsMovementReplayResult& GetReplayResult() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Movement Recorder")
+	void StartRecording();
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Movement Recorder")
+	FAlsMovementRecording StopRecording();
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Movement Recorder")
+	void StartReplay(const FAlsMovementRecording& NewRecording);
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Movement Recorder")
+	FAlsMovementReplayResult StopReplay();
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Movement Recorder")
+	static bool SaveRecording(const FAlsMovementRecording& SourceRecording, const FString& FilePath);
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Movement Recorder")
+	static bool LoadRecording(const FString& FilePath, FAlsMovementRecording& TargetRecording);
+
+private:
+	void RestoreStartState();
+
+	void RecordFrame(float DeltaTime);
+
+	void ReplayFrame(float DeltaTime);
+
+	void CompareFrame(int32 FrameIndex);
+};
+
+inline bool UAlsMovementRecorderComponent::IsRecording() const
+{
+	return bRecording;
+}
+
+inline bool UAlsMovementRecorderComponent::IsReplaying() const
+{
+	return ReplayFrameIndex != INDEX_NONE;
+}
+
+inline const FAlsMovementReplayResult& UAlsMovementRecorderComponent::GetReplayResult() const
+{
+	return ReplayResult;
+}
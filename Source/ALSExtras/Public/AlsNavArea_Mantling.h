@@ -0,0 +1,14 @@
+#pragma once
+
+#include "NavAreas/NavArea.h"
+#include "AlsNavArea_Mantling.generated.h"
+
+// Area of navigation links that can only be traversed by mantling.
+UCLASS(DisplayName = "Als Nav Area Mantling")
+class ALSEXTRAS_API UAlsNavArea_Mantling : public UNavArea
+{
+	GENERATED_BODY()
+
+public:
+	UAlsNavArea_Mantling();
+};
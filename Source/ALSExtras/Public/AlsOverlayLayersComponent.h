@@ -0,0 +1,76 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Components/ActorComponent.h"
+#include "AlsOverlayLayersComponent.generated.h"
+
+struct FStreamableHandle;
+class AAlsCharacter;
+class UAnimInstance;
+
+// Links overlay animation layers that match the character's overlay mode. Layer classes are loaded asynchronously when
+// the overlay mode is first requested or preloaded, and the default overlay layers are linked until loading finishes.
+UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent))
+class ALSEXTRAS_API UAlsOverlayLayersComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+protected:
+	// Linked when there are no layers for the current overlay mode or while they are being loaded. If not
+	// set, the overlay layers are unlinked, and the layer implementations of the main animation blueprint are used.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TSubclassOf<UAnimInstance> DefaultOverlayLayers;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ForceInlineRow))
+	TMap<FGameplayTag, TSoftClassPtr<UAnimInstance>> OverlayLayers;
+
+	// Maximum number of overlay layer classes kept loaded. The least recently used ones are released first.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 1))
+	int32 MaxResidentOverlayLayers{4};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TObjectPtr<AAlsCharacter> Character;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FGameplayTag OverlayMode;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TSubclassOf<UAnimInstance> LinkedOverlayLayers;
+
+	// Overlay modes with loaded or loading layers, from the least to the most recently used.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TArray<FGameplayTag> ResidentOverlayModes;
+
+	TMap<FGameplayTag, TSharedPtr<FStreamableHandle>> StreamableHandles;
+
+public:
+	UAlsOverlayLayersComponent();
+
+	virtual void OnRegister() override;
+
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Starts loading the layers of an overlay mode that is likely to be used soon, for example when a weapon is picked up.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Overlay Layers", Meta = (AutoCreateRefTerm = "PredictedOverlayMode"))
+	void PreloadOverlayMode(const FGameplayTag& PredictedOverlayMode);
+
+	UFUNCTION(BlueprintPure, Category = "ALS|Als Overlay Layers", Meta = (AutoCreateRefTerm = "OverlayModeToCheck"))
+	bool IsOverlayModeLoaded(const FGameplayTag& OverlayModeToCheck) const;
+
+private:
+	void RefreshOverlayMode();
+
+	void LoadOverlayLayers(const FGameplayTag& NewOverlayMode);
+
+	void OnOverlayLayersLoaded(FGameplayTag LoadedOverlayMode);
+
+	void ReleaseUnusedOverlayLayers();
+
+	void ApplyOverlayLayers();
+
+	void LinkOverlayLayers(TSubclassOf<UAnimInstance> NewOverlayLayers);
+};
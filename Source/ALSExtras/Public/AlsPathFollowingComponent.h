@@ -0,0 +1,110 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Navigation/CrowdFollowingComponent.h"
+#include "Utility/AlsGameplayTags.h"
+#include "AlsPathFollowingComponent.generated.h"
+
+class AAlsCharacter;
+
+// Crowd path following for ALS characters. Selects the desired gait from the path curvature and crowd density,
+// so that characters slow down before sharp corners and in dense crowds instead of overshooting and bunching up.
+// Also starts mantling when the character reaches a navigation link with the mantling area. Crowd paths are not
+// string pulled, so with crowd simulation enabled, corners and links are taken from the crowd agent instead.
+UCLASS()
+class ALSEXTRAS_API UAlsPathFollowingComponent : public UCrowdFollowingComponent
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following")
+	bool bSelectDesiredGait{true};
+
+	// Gait used on straight paths without crowding.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following", Meta = (EditCondition = "bSelectDesiredGait"))
+	FGameplayTag FastGait{AlsGaitTags::Running};
+
+	// Gait used before sharp corners and in crowds.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following", Meta = (EditCondition = "bSelectDesiredGait"))
+	FGameplayTag SlowGait{AlsGaitTags::Walking};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following",
+		Meta = (EditCondition = "bSelectDesiredGait", ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
+	float SharpCornerAngle{60.0f};
+
+	// Distance before a sharp corner at which the character switches to the slow gait.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following",
+		Meta = (EditCondition = "bSelectDesiredGait", ClampMin = 0, ForceUnits = "cm"))
+	float SharpCornerDistance{250.0f};
+
+	// Number of nearby crowd agents at which the character switches to the slow gait.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following",
+		Meta = (EditCondition = "bSelectDesiredGait", ClampMin = 1))
+	int32 CrowdedAgentsCount{4};
+
+	// How long the selected gait must remain the same before it's applied. Prevents oscillation between gaits.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following",
+		Meta = (EditCondition = "bSelectDesiredGait", ClampMin = 0, ForceUnits = "s"))
+	float GaitChangeDelay{0.5f};
+
+	// Distance to the start of a mantling link at which the character starts trying to mantle. With crowd
+	// simulation enabled, crowd steering is also suspended at this distance until mantling is finished.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MantlingStartDistance{150.0f};
+
+	// How often the character tries to start mantling while approaching a mantling link.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Path Following", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float MantlingRetryInterval{0.2f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient)
+	TObjectPtr<AAlsCharacter> Character;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient)
+	bool bMantlingSegment;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient)
+	bool bMantlingStarted;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient)
+	bool bCrowdSteeringSuspendedForMantling;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient)
+	FVector MantlingLinkStartLocation;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient)
+	FVector MantlingLinkEndLocation;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient, Meta = (ForceUnits = "s"))
+	float MantlingRetryTimeRemaining;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient)
+	FGameplayTag PendingGait;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Path Following", Transient, Meta = (ForceUnits = "s"))
+	float PendingGaitTime;
+
+public:
+	virtual void SetMovementComponent(UNavMovementComponent* NewMovementComponent) override;
+
+protected:
+	virtual void SetMoveSegment(int32 SegmentStartIndex) override;
+
+	virtual void FollowPathSegment(float DeltaTime) override;
+
+	virtual void OnPathFinished(const FPathFollowingResult& Result) override;
+
+private:
+	void StartMantlingSegment(const FVector& LinkStartLocation, const FVector& LinkEndLocation);
+
+	void StopMantlingSegment();
+
+	bool TryStartCrowdMantlingSegment();
+
+	void FollowMantlingSegment(float DeltaTime);
+
+	void RefreshDesiredGait(float DeltaTime);
+
+	FGameplayTag SelectDesiredGait() const;
+
+	bool FindNextCorner(FVector& PreviousLocation, FVector& CornerLocation, FVector& NextLocation) const;
+};